@@ -0,0 +1,427 @@
+// 📈 SUITE DE BENCHMARKS DU CŒUR DE SIMULATION
+// Mesure Ecosystem::Update de 1k à 1M entités, la mise à l'échelle sur
+// plusieurs threads, les comportements d'Entity pris isolément, le noyau de
+// steering et le pas du champ de nourriture sur chaque jeu d'instructions
+// disponible, un monde clairsemé avec et sans régions endormies, les phases
+// structurelles (retrait des morts, reproduction, repas et prédation), le
+// rendu dans un renderer logiciel hors écran et le débit d'un ensemble de
+// runs. Graines fixes : deux exécutions sur la même machine mesurent
+// exactement le même travail.
+//
+// Sortie : une ligne JSON par mesure sur stdout (JSON Lines), pour suivre
+// les régressions d'une version à l'autre :
+//   ./EcosystemBench > resultats.jsonl
+// Options : --max-population N (défaut 1000000), --max-threads N (défaut : cœurs),
+//           --min-time S (durée minimale d'une mesure, défaut 0.5)
+#include "Core/Ecosystem.h"
+#include "Core/EnsembleRunner.h"
+#include "Core/Logger.h"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Core = Ecosystem::Core;
+
+// 🧮 COMPTAGE DES ALLOCATIONS : tous les threads passent par ces opérateurs
+static std::atomic<unsigned long long> gAllocations{0};
+
+void* operator new(std::size_t size) {
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) {
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+
+namespace {
+
+const uint32_t BENCH_SEED = 12345;
+const float DELTA_TIME = 1.0f / 60.0f;
+const float AREA_PER_ENTITY = 1200.0f * 600.0f / 55.0f;  // Densité de la scène par défaut
+
+struct Options {
+    int maxPopulation = 1000000;
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    double minTime = 0.5;
+};
+
+// 🌍 Monde de référence : proportions de la scène par défaut, densité constante
+std::unique_ptr<Core::Ecosystem> MakeWorld(int population, unsigned threads) {
+    const float side = std::sqrt(AREA_PER_ENTITY * population / 2.0f);
+    auto world = std::make_unique<Core::Ecosystem>(side * 2.0f, side, population * 2);
+    world->SetSeed(BENCH_SEED);
+    world->SetThreadCount(threads);
+    world->Initialize(population * 20 / 55, population * 5 / 55, population * 30 / 55);
+    return world;
+}
+
+// ⏱ Résultat d'une mesure : durée, répétitions, allocations
+struct Sample {
+    double nanoseconds = 0.0;
+    long long repetitions = 0;
+    unsigned long long allocations = 0;
+};
+
+double Now() {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Répète body jusqu'à minTime (au moins minRepetitions fois) ; setup hors chronomètre
+Sample Measure(double minTime, long long minRepetitions, const std::function<void()>& setup,
+               const std::function<void()>& body) {
+    Sample sample;
+    while (sample.repetitions < minRepetitions || sample.nanoseconds < minTime * 1e9) {
+        if (setup) setup();
+        const unsigned long long allocationsBefore = gAllocations.load(std::memory_order_relaxed);
+        const double start = Now();
+        body();
+        sample.nanoseconds += Now() - start;
+        sample.allocations += gAllocations.load(std::memory_order_relaxed) - allocationsBefore;
+        ++sample.repetitions;
+    }
+    return sample;
+}
+
+// 🧾 Une ligne JSON par mesure
+void Report(const char* benchmark, int population, unsigned threads, const Sample& sample, double entitiesPerRepetition,
+            const std::string& extra = "") {
+    const double perRepetition = sample.nanoseconds / sample.repetitions;
+    std::printf("{\"benchmark\":\"%s\",\"population\":%d,\"threads\":%u,\"repetitions\":%lld,"
+                "\"ns_per_repetition\":%.1f,\"ns_per_entity\":%.3f,\"allocations_per_repetition\":%.2f%s}\n",
+                benchmark, population, threads, sample.repetitions, perRepetition,
+                entitiesPerRepetition > 0.0 ? perRepetition / entitiesPerRepetition : 0.0,
+                static_cast<double>(sample.allocations) / sample.repetitions, extra.c_str());
+    std::fflush(stdout);
+}
+
+// ⚙️ Ecosystem::Update : ns par entité et par tick
+Sample BenchUpdate(const Options& options, int population, unsigned threads, double& entitiesPerTick) {
+    auto world = MakeWorld(population, threads);
+    for (int i = 0; i < 5; ++i) world->Update(DELTA_TIME);  // Échauffement : tampons et grilles dimensionnés
+    long long entityTicks = 0;
+    Sample sample = Measure(options.minTime, 3, nullptr, [&] {
+        entityTicks += world->GetEntityCount();
+        world->Update(DELTA_TIME);
+    });
+    entitiesPerTick = static_cast<double>(entityTicks) / sample.repetitions;
+    return sample;
+}
+
+// 🧭 Comportements d'Entity, appelés un par un sur toutes les entités mobiles
+void BenchBehaviours(const Options& options, int population) {
+    auto world = MakeWorld(population, 1);
+    world->Update(DELTA_TIME);
+    world->RebuildSpatialIndex();
+    const Core::EntityStore& store = world->GetEntities();
+    std::vector<size_t> movers;
+    for (size_t i = 0; i < store.Size(); ++i) {
+        if (store.alive[i] && store.type[i] != Core::EntityType::PLANT) movers.push_back(i);
+    }
+    volatile float sink = 0.0f;
+    const double count = static_cast<double>(movers.size());
+
+    Sample seek = Measure(options.minTime, 3, nullptr, [&] {
+        float total = 0.0f;
+        for (size_t i : movers) {
+            total += world->GetEntity(i).SeekFood(world->GetFoodSources(), world->GetFoodGrid()).x;
+        }
+        sink = sink + total;
+    });
+    Report("entity_seek_food", population, 1, seek, count);
+
+    Sample avoid = Measure(options.minTime, 3, nullptr, [&] {
+        float total = 0.0f;
+        for (size_t i : movers) {
+            total += world->GetEntity(i).AvoidPredators(store, world->GetPredatorGrid()).x;
+        }
+        sink = sink + total;
+    });
+    Report("entity_avoid_predators", population, 1, avoid, count);
+
+    Sample bounds = Measure(options.minTime, 3, nullptr, [&] {
+        float total = 0.0f;
+        for (size_t i : movers) {
+            total += world->GetEntity(i).StayInBounds(world->GetWorldWidth(), world->GetWorldHeight()).x;
+        }
+        sink = sink + total;
+    });
+    Report("entity_stay_in_bounds", population, 1, bounds, count);
+}
+
+// ⚡ Noyau de steering sur un lot empaqueté, pour chaque jeu d'instructions disponible
+void BenchSteeringKernels(const Options& options, int population) {
+    auto world = MakeWorld(population, 1);
+    world->Update(DELTA_TIME);
+    world->RebuildSpatialIndex();
+    const Core::EntityStore& store = world->GetEntities();
+    const auto& food = world->GetFoodSources();
+    Core::SteeringBatch batch;
+    for (size_t i = 0; i < store.Size(); ++i) {
+        const Core::SpeciesTraits& traits = Core::TraitsOf(store.type[i]);
+        if (!store.alive[i] || traits.moveSpeed <= 0.0f) continue;
+        const bool eatsFood = traits.diet == Core::Diet::FOOD && !food.empty();
+        const int nearest = eatsFood ? world->FindNearestFood(store.position[i], traits.seekRadius) : -1;
+        batch.Add(static_cast<uint32_t>(i), store.position[i], store.velocity[i], nearest >= 0 ? &food[nearest].position : nullptr);
+        if (traits.avoidRadius <= 0.0f) continue;
+        world->GetPredatorGrid().ForEachInRadius(store.position[i], traits.avoidRadius, [&](uint32_t predator, float) {
+            batch.AddPredator(store.position[predator]);
+        });
+    }
+    const std::vector<float> vx = batch.vx;
+    const std::vector<float> vy = batch.vy;
+    for (Core::SimdPath path : {Core::SimdPath::SCALAR, Core::SimdPath::SSE2, Core::SimdPath::AVX2}) {
+        if (Core::DetectSimdPath() < path) continue;
+        Sample sample = Measure(options.minTime, 3, [&] {
+            std::copy(vx.begin(), vx.end(), batch.vx.begin());
+            std::copy(vy.begin(), vy.end(), batch.vy.begin());
+        }, [&] {
+            Core::SteerBatch(batch, world->GetWorldWidth(), world->GetWorldHeight(), path);
+        });
+        const std::string extra = std::string(",\"simd\":\"") + Core::SimdPathName(path) + "\"";
+        Report("steering_kernel", population, 1, sample, static_cast<double>(batch.Size()), extra);
+    }
+}
+
+// 🌾 Pas du champ de nourriture (diffusion + repousse) sur un monde de la taille de la population
+void BenchFoodField(const Options& options, int population) {
+    const float side = std::sqrt(AREA_PER_ENTITY * population / 2.0f);
+    Core::FoodField field;
+    field.Configure(side * 2.0f, side);
+    field.Fill(BENCH_SEED, 0);
+    Core::TaskScheduler scheduler(1);
+    const double cells = static_cast<double>(field.GetColumns()) * field.GetRows();
+    for (Core::SimdPath path : {Core::SimdPath::SCALAR, Core::SimdPath::SSE2, Core::SimdPath::AVX2}) {
+        if (Core::DetectSimdPath() < path) continue;
+        Sample sample = Measure(options.minTime, 3, [] {}, [&] { field.Step(scheduler, path); });
+        const std::string extra = std::string(",\"simd\":\"") + Core::SimdPathName(path) + "\",\"cells\":" +
+                                  std::to_string(static_cast<long long>(cells));
+        // ns_per_entity se lit ici en ns par cellule
+        Report("food_field_step", population, 1, sample, cells, extra);
+    }
+}
+
+// 🌱 Update d'un monde vaste et clairsemé (plantes surtout), régions endormies ou non : les
+// plantes dormantes et les régions endormies ne coûtent rien
+void BenchPlantWorld(const Options& options, int population) {
+    const float side = std::sqrt(AREA_PER_ENTITY * population * 8.0f / 2.0f);
+    for (bool sleeping : {false, true}) {
+        auto world = std::make_unique<Core::Ecosystem>(side * 2.0f, side, population * 2);
+        world->SetSeed(BENCH_SEED);
+        world->SetSleepingEnabled(sleeping);
+        world->Initialize(population / 200, population / 1000, population - population / 200 - population / 1000);
+        for (int i = 0; i < 600; ++i) world->Update(DELTA_TIME);  // Échauffement : les régions calmes s'endorment
+        long long entityTicks = 0;
+        Sample sample = Measure(options.minTime, 3, nullptr, [&] {
+            entityTicks += world->GetEntityCount();
+            world->Update(DELTA_TIME);
+        });
+        const Core::EntityStore& store = world->GetEntities();
+        const size_t dormant = static_cast<size_t>(std::count(store.dormant.begin(), store.dormant.end(), 1));
+        const double entities = static_cast<double>(std::max(1, world->GetEntityCount()));
+        char extra[128];
+        std::snprintf(extra, sizeof(extra), ",\"sleeping\":%s,\"asleep_fraction\":%.3f,\"dormant_fraction\":%.3f",
+                      sleeping ? "true" : "false", world->GetRegions().GetSleepingEntityCount() / entities,
+                      dormant / entities);
+        Report("update_sparse", population, 1, sample, static_cast<double>(entityTicks) / sample.repetitions, extra);
+    }
+}
+
+// 🧹 RemoveDeadEntities sur un monde neuf à chaque répétition : 10 % de morts restent
+// des tombes, 25 % déclenchent la compaction
+void BenchRemoveDead(const Options& options, int population) {
+    for (int stride : {10, 4}) {
+        std::unique_ptr<Core::Ecosystem> world;
+        double entities = 0.0;
+        Sample sample = Measure(options.minTime, 3, [&] {
+            world = MakeWorld(population, 1);
+            for (int i = 0; i < world->GetEntityCount(); i += stride) world->MarkDead(i);
+            entities += world->GetEntityCount();
+        }, [&] { world->RemoveDeadEntities(); });
+        char extra[64];
+        std::snprintf(extra, sizeof(extra), ",\"dead_fraction\":%.2f", 1.0 / stride);
+        Report("remove_dead_entities", population, 1, sample, entities / sample.repetitions, extra);
+    }
+}
+
+// 👶 HandleReproduction avec des parents éligibles (âge et énergie suffisants)
+void BenchReproduction(const Options& options, int population) {
+    std::unique_ptr<Core::Ecosystem> world;
+    double entities = 0.0;
+    long long births = 0;
+    int before = 0;
+    Sample sample = Measure(options.minTime, 3, [&] {
+        world = MakeWorld(population, 1);
+        world->Update(2.5f);  // Un grand pas fait vieillir tout le monde au-delà de l'âge de reproduction
+        const Core::EntityStore& store = world->GetEntities();
+        for (size_t i = 0; i < store.Size(); ++i) world->GetEntity(i).Eat(1e9f);
+        before = world->GetEntityCount();
+        entities += before;
+    }, [&] {
+        world->HandleReproduction();
+        world->ApplyCommands();  // Les enfants naissent au point de synchronisation
+        births += world->GetEntityCount() - before;
+    });
+    char extra[64];
+    std::snprintf(extra, sizeof(extra), ",\"births_per_repetition\":%.1f",
+                  static_cast<double>(births) / sample.repetitions);
+    Report("handle_reproduction", population, 1, sample, entities / sample.repetitions, extra);
+}
+
+// 🍽 HandleEating (nourriture et prédation) sur un monde qui vient d'avancer d'un tick
+void BenchEating(const Options& options, int population) {
+    std::unique_ptr<Core::Ecosystem> world;
+    double entities = 0.0;
+    long long kills = 0;
+    Sample sample = Measure(options.minTime, 3, [&] {
+        world = MakeWorld(population, 1);
+        world->Update(DELTA_TIME);
+        entities += world->GetEntityCount();
+    }, [&] {
+        world->HandleEating();
+        const Core::EntityStore& store = world->GetEntities();
+        for (size_t i = 0; i < store.Size(); ++i) {
+            kills += !store.alive[i] && !store.IsTombstone(i) && Core::TraitsOf(store.type[i]).prey;
+        }
+    });
+    char extra[64];
+    std::snprintf(extra, sizeof(extra), ",\"kills_per_repetition\":%.1f",
+                  static_cast<double>(kills) / sample.repetitions);
+    Report("handle_eating", population, 1, sample, entities / sample.repetitions, extra);
+}
+
+// 🎨 Ecosystem::Render dans un renderer logiciel (surface hors écran)
+void BenchRender(const Options& options, int population) {
+    SDL_Surface* surface = SDL_CreateSurface(1280, 720, SDL_PIXELFORMAT_RGBA8888);
+    SDL_Renderer* renderer = surface ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (!renderer) {
+        std::fprintf(stderr, "❌ Renderer logiciel indisponible: %s\n", SDL_GetError());
+        if (surface) SDL_DestroySurface(surface);
+        return;
+    }
+    // Corps seuls (seuil 0), puis niveau de détail par défaut : carte de densité au-delà du seuil
+    for (size_t threshold : {size_t(0), Core::DEFAULT_LOD_THRESHOLD}) {
+        auto world = MakeWorld(population, 1);
+        world->SetLodThreshold(threshold);
+        world->Update(DELTA_TIME);
+        world->Render(renderer, 0.5f);  // Échauffement : lot de rendu dimensionné, carte envoyée entière
+        Sample sample = Measure(options.minTime, 3, nullptr, [&] {
+            SDL_RenderClear(renderer);
+            world->Render(renderer, 0.5f);
+        });
+        Core::RenderFrame frame;
+        world->CaptureFrame(frame);
+        char extra[96];
+        std::snprintf(extra, sizeof(extra), ",\"lod_threshold\":%zu,\"detail\":%.2f", threshold, frame.detail);
+        Report("render_software", population, 1, sample, world->GetEntityCount() + world->GetFoodCount(), extra);
+    }  // Le monde (et sa texture) disparaît avant le renderer
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(surface);
+}
+
+// 🧪 Ensemble de petits mondes indépendants : débit en runs selon le nombre de workers
+void BenchEnsemble(const Options& options) {
+    Core::EnsembleSpec spec;
+    spec.replicates = 32;
+    spec.ticks = 600;
+    spec.seed = BENCH_SEED;
+    spec.axes.push_back({Core::EnsembleParameter::REPRODUCTION_CHANCE, {0.2, 0.3}});
+    const std::string path = "ensemble_bench.bin";
+    double singleWorker = 0.0;
+    for (unsigned workers = 1;; workers = std::min(workers * 2, options.maxThreads)) {
+        Core::EnsembleRunner::Report report{0, 0.0, 0};
+        bool ok = true;
+        Sample sample = Measure(options.minTime, 1, nullptr, [&] {
+            ok = ok && Core::EnsembleRunner::Run(spec, path, workers, report);
+        });
+        if (!ok) break;
+        const double perEnsemble = sample.nanoseconds / sample.repetitions;
+        if (workers == 1) singleWorker = perEnsemble;
+        char extra[64];
+        std::snprintf(extra, sizeof(extra), ",\"speedup\":%.3f", singleWorker / perEnsemble);
+        Report("ensemble_runs", static_cast<int>(report.runs), workers, sample, static_cast<double>(report.runs), extra);
+        if (workers == options.maxThreads) break;
+    }
+    std::remove(path.c_str());
+}
+
+bool ParseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string flag = argv[i];
+        if (i + 1 >= argc) return false;
+        const char* value = argv[++i];
+        if (flag == "--max-population") options.maxPopulation = std::atoi(value);
+        else if (flag == "--max-threads") options.maxThreads = static_cast<unsigned>(std::max(1, std::atoi(value)));
+        else if (flag == "--min-time") options.minTime = std::atof(value);
+        else return false;
+    }
+    return options.maxPopulation > 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: %s [--max-population N] [--max-threads N] [--min-time S]\n", argv[0]);
+        return 1;
+    }
+    // Le journal des entités ne fait pas partie de la mesure
+    Core::Logger::SetLevel(Core::LogLevel::WARNING);
+    std::printf("{\"suite\":\"ecosystem\",\"format\":1,\"seed\":%u,\"hardware_threads\":%u,\"min_time_s\":%g}\n",
+                BENCH_SEED, std::thread::hardware_concurrency(), options.minTime);
+
+    // 1. Coût d'un tick selon la population (un thread)
+    for (int population : {1000, 10000, 100000, 1000000}) {
+        if (population > options.maxPopulation) break;
+        double entitiesPerTick = 0.0;
+        Sample sample = BenchUpdate(options, population, 1, entitiesPerTick);
+        Report("update", population, 1, sample, entitiesPerTick);
+    }
+
+    // 2. Mise à l'échelle sur plusieurs threads (résultats identiques, seul le temps change)
+    const int scalingPopulation = std::min(100000, options.maxPopulation);
+    double singleThread = 0.0;
+    for (unsigned threads = 1;; threads = std::min(threads * 2, options.maxThreads)) {
+        double entitiesPerTick = 0.0;
+        Sample sample = BenchUpdate(options, scalingPopulation, threads, entitiesPerTick);
+        const double perTick = sample.nanoseconds / sample.repetitions;
+        if (threads == 1) singleThread = perTick;
+        char extra[64];
+        std::snprintf(extra, sizeof(extra), ",\"speedup\":%.3f", singleThread / perTick);
+        Report("update_scaling", scalingPopulation, threads, sample, entitiesPerTick, extra);
+        if (threads == options.maxThreads) break;
+    }
+
+    // 3. Noyaux et phases isolés
+    const int kernelPopulation = std::min(100000, options.maxPopulation);
+    BenchBehaviours(options, kernelPopulation);
+    BenchSteeringKernels(options, kernelPopulation);
+    BenchFoodField(options, kernelPopulation);
+    BenchPlantWorld(options, kernelPopulation);
+    BenchRemoveDead(options, kernelPopulation);
+    BenchReproduction(options, kernelPopulation);
+    BenchEating(options, kernelPopulation);
+    BenchRender(options, kernelPopulation);
+
+    // 4. Parallélisme entre runs indépendants (un écosystème par worker)
+    BenchEnsemble(options);
+    return 0;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🎮 COMMANDES DE L'INTERFACE VERS LA SIMULATION
+enum class SimulationCommandType : uint8_t {
+    KEY,            // Touche sans effet sur la simulation (seulement tracée)
+    TOGGLE_PAUSE,
+    RESET,
+    SAVE_SNAPSHOT,
+    SPAWN_FOOD,
+    SPEED_UP,
+    SLOW_DOWN,
+    SET_VIEW        // Vue de la caméra : ce que les images suivantes doivent contenir (non tracée)
+};
+
+struct SimulationCommand {
+    SimulationCommandType type;
+    uint32_t key;      // Touche d'origine, enregistrée dans la trace
+    float view[4];     // SET_VIEW : x, y, largeur, hauteur visibles (monde) et
+    float viewScale;   // pixels par unité du monde
+};
+
+// 📬 FILE DE COMMANDES SANS VERROU (un producteur, un consommateur)
+// Anneau de capacité fixe : le thread d'interface pousse, le thread de
+// simulation dépile entre deux ticks. Pleine, Push() refuse la commande.
+class CommandQueue {
+public:
+    static const size_t CAPACITY = 256;  // Puissance de deux
+
+private:
+    SimulationCommand mCommands[CAPACITY];
+    std::atomic<size_t> mHead{0};  // Écrit par le producteur
+    std::atomic<size_t> mTail{0};  // Écrit par le consommateur
+
+public:
+    bool Push(const SimulationCommand& command) {
+        const size_t head = mHead.load(std::memory_order_relaxed);
+        if (head - mTail.load(std::memory_order_acquire) >= CAPACITY) return false;
+        mCommands[head & (CAPACITY - 1)] = command;
+        mHead.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Pop(SimulationCommand& command) {
+        const size_t tail = mTail.load(std::memory_order_relaxed);
+        if (tail == mHead.load(std::memory_order_acquire)) return false;
+        command = mCommands[tail & (CAPACITY - 1)];
+        mTail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,91 @@
+#pragma once
+#include "EntityStore.h"
+#include "RenderFrame.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🗺 PARAMÈTRES DE LA CARTE DE DENSITÉ
+const size_t DEFAULT_LOD_THRESHOLD = 20000;  // Entités visibles au-delà desquelles seule la carte est dessinée
+const int DENSITY_MAX_COLUMNS = 512;         // Largeur maximale de la texture
+const float DENSITY_MIN_CELL_SIZE = 16.0f;   // Côté minimal d'une cellule en unités du monde
+const uint32_t DENSITY_SATURATION = 12;      // Entités d'une espèce par cellule pour une couleur pleine
+const int DENSITY_TILE_SIZE = 32;            // Côté d'une tuile suivie, en cellules
+
+// 🗺 CARTE DE DENSITÉ PAR ESPÈCE
+// Compte les entités de chaque espèce par cellule et en tient une image RGBA8888 :
+// carnivores en rouge, plantes en vert, herbivores en bleu, comme les entités
+// elles-mêmes. Les comptes suivent la simulation (naissances, morts, changements
+// de cellule) au lieu d'être refaits à chaque image ; Recount() ne sert qu'après
+// un changement d'état hors des ticks. TakeDirty() ne repeint que les cellules
+// dont un compte a bougé, marque leur tuile, et copie les tuiles marquées,
+// fusionnées en suites le long de chaque rangée de tuiles, dans l'image publiée :
+// c'est tout ce que la texture doit recevoir.
+class DensityMap {
+private:
+    float mWorldWidth;
+    float mWorldHeight;
+    float mCellSize;
+    float mInvCellSize;
+    int mColumns;
+    int mRows;
+    std::vector<uint32_t> mCounts;        // 3 comptes par cellule, dans l'ordre d'EntityType
+    size_t mTotal;                        // Somme de tous les comptes
+    std::vector<uint32_t> mChangedCells;  // Cellules dont un compte a bougé depuis la dernière image
+    std::vector<uint8_t> mCellChanged;
+    std::vector<uint32_t> mPixels;        // Un pixel par cellule
+    int mTileColumns;
+    int mTileRows;
+    std::vector<uint8_t> mDirtyTiles;  // Tuiles modifiées depuis le dernier TakeDirty
+
+public:
+    // 🏗 CONSTRUCTEUR (carte vide tant que Configure n'est pas appelé)
+    DensityMap();
+
+    // ⚙️ Dimensionne la carte sur le monde ; tout est marqué modifié
+    void Configure(float worldWidth, float worldHeight);
+    bool Matches(float worldWidth, float worldHeight) const {
+        return mColumns > 0 && worldWidth == mWorldWidth && worldHeight == mWorldHeight;
+    }
+
+    bool IsActive() const { return mColumns > 0; }  // Comptes à tenir à jour
+
+    // 🔄 COMPTES : Recount() repart de toutes les lignes encore à retirer (tout sauf
+    // les tombes) ; ensuite chaque naissance, mort et changement de cellule est reporté
+    void Recount(const EntityStore& store);
+    void Add(Vector2D position, EntityType type) { AddToCell(CellOf(position), type, 1); }
+    void Remove(Vector2D position, EntityType type) { AddToCell(CellOf(position), type, -1); }
+    void Move(Vector2D from, Vector2D to, EntityType type) {
+        const size_t before = CellOf(from);
+        const size_t after = CellOf(to);
+        if (before == after) return;
+        AddToCell(before, type, -1);
+        AddToCell(after, type, 1);
+    }
+    // 👁 Entités des cellules qui touchent la vue (toutes pour le monde entier)
+    size_t CountVisible(const RenderView& view) const;
+
+    // 📤 Repeint les cellules changées, copie la géométrie et les tuiles modifiées dans patch, puis les oublie
+    void TakeDirty(DensityPatch& patch);
+
+    // 📊 GETTERS
+    int GetColumns() const { return mColumns; }
+    int GetRows() const { return mRows; }
+    float GetCellSize() const { return mCellSize; }
+    uint32_t GetCount(int column, int row, EntityType type) const {
+        return mCounts[(static_cast<size_t>(row) * mColumns + column) * 3 + static_cast<size_t>(type)];
+    }
+
+private:
+    // Bornées en flottant avant le cast (positions hors monde ou NaN)
+    int ColumnOf(float x) const;
+    int RowOf(float y) const;
+    size_t CellOf(Vector2D position) const { return static_cast<size_t>(RowOf(position.y)) * mColumns + ColumnOf(position.x); }
+    void AddToCell(size_t cell, EntityType type, int delta);
+};
+
+} // namespace Core
+} // namespace Ecosystem
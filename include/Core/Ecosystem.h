@@ -1,29 +1,135 @@
 #pragma once
 
 #include "Entity.h"
+#include "EntityStore.h"
+#include "EntityCommandBuffer.h"
+#include "FoodField.h"
 #include "Structs.h"
+#include "SpatialGrid.h"
+#include "TaskScheduler.h"
+#include "Random.h"
+#include "EventTrace.h"
+#include "StatisticsHistory.h"
+#include "Steering.h"
+#include "PlantSchedule.h"
+#include "WorldRegions.h"
+#include "RenderFrame.h"
+#include "DensityMap.h"
+#include "../Graphics/DensityTexture.h"
+#include <string>
 #include <vector>
 #include <memory>
-#include <random>
 
 namespace Ecosystem {
 namespace Core {
 
+class TileDomain;
 
 class Ecosystem {
 private:
     // 🔒 ÉTAT INTERNE
-    std::vector<std::unique_ptr<Entity>> mEntities;
+    EntityStore mEntities;  // Colonnes contiguës, parcourues linéairement
     std::vector<Food> mFoodSources;
+    FoodField mFoodField;  // Champ dense optionnel : remplace mFoodSources quand il est actif
+    
+    // 🗺 INDEX SPATIAUX (reconstruits à chaque tick)
+    SpatialGrid mFoodGrid;      // indices dans mFoodSources
+    SpatialGrid mPredatorGrid;  // indices denses des carnivores vivants dans mEntities
+    SpatialGrid mPreyGrid;      // indices denses des proies vivantes, positions d'après le mouvement (contacts)
+    
+    // 🌱 PLANTES EN FORME CLOSE ET RÉGIONS ENDORMIES : les plantes immatures (dormant) sortent
+    // des étapes du tick, les entités des régions endormies (asleep) de tout parcours. Chaque
+    // tranche garde ses séries, relevées seulement quand l'état d'une de ses lignes change :
+    // un tick coûte ce que coûtent ses entités éveillées, pas la taille du monde
+    PlantSchedule mPlants;
+    WorldRegions mRegions;
+    struct ChunkRuns {
+        std::vector<uint32_t> awake;    // Paires [début, fin) ni dormantes ni endormies : étapes du tick
+        std::vector<uint32_t> present;  // Paires [début, fin) non endormies : énergie moyenne, positions
+    };
+    std::vector<ChunkRuns> mChunkRuns;   // Une entrée par tranche (vide : toutes éveillées, tout à relever)
+    std::vector<uint8_t> mChunkDirty;
+    std::vector<uint32_t> mDirtyChunks;  // Tranches à relever au prochain BuildAwakeRuns
+    std::vector<size_t> mChangedRows;    // Lignes dont l'état vient de changer (tampon réutilisé)
+    std::vector<uint32_t> mAwakeRows;    // Lignes éveillées, croissantes : grilles des animaux, activité
+    std::vector<uint32_t> mSleepCandidates;
+    size_t mAwakeCounted;                // Entités décomptées ; les suivantes sont parcourues d'office
     float mWorldWidth;
     float mWorldHeight;
     int mMaxEntities;
     int mDayCycle;
     
-    // 🎲 Générateur aléatoire
-    std::mt19937 mRandomGenerator;
+    // 🎲 Générateur aléatoire : tirages du monde, fonction de (graine, tick, n° du tirage)
+    uint64_t mSeed;
+    RandomStream mWorldRandom;
+    
+    // 🧵 PARALLÉLISME : les phases par entité sont découpées en tranches ;
+    // les demandes passent par des tampons par thread, fusionnés dans l'ordre
+    // des indices à la fin de chaque phase
+    // Demande d'un mangeur sur une cible (nourriture ou proie) : à cible égale, le plus petit indice l'emporte
+    struct Claim {
+        uint32_t target;
+        uint32_t entity;
+    };
+    struct WorkerBuffers {
+        std::vector<Claim> foodClaims;
+        std::vector<Claim> preyClaims;
+        SteeringBatch steering[SPECIES_COUNT];  // Entités de la tranche empaquetées par espèce pour les noyaux SIMD
+    };
+    std::unique_ptr<TaskScheduler> mScheduler;
+    std::vector<WorkerBuffers> mWorkerBuffers;
+    std::vector<Claim> mMergedClaims;
+    // 📝 Changements structurels du tick (naissances, morts, apparitions, nourriture
+    // mangée), appliqués d'un seul lot par ApplyCommands à la fin du tick
+    EntityCommandBuffer mCommands;
+    
+    // 🎞 Trace d'événements (non possédée, nulle si la trace est inactive)
+    TraceRecorder* mTrace;
+    
+    // 🧩 TUILES (non possédé, nul hors découpage) : ce processus ne simule que sa tuile,
+    // les fantômes et les décisions communes passent par des échanges avec les autres rangs
+    TileDomain* mDomain;
+    struct HaloRecord {
+        EntityRecord entity;
+        uint32_t ghost;  // 1 : copie en lecture seule, 0 : l'entité change de propriétaire
+    };
+    // État d'une proie d'après le mouvement, envoyé aux rangs qui la tiennent en fantôme
+    struct PreyState {
+        Vector2D position;
+        float energy;
+        EntityId id;
+        uint32_t alive;
+    };
+    struct TileBuffers {
+        std::vector<std::vector<HaloRecord>> haloOut;
+        std::vector<std::vector<HaloRecord>> haloIn;
+        std::vector<std::vector<PreyState>> preyOut;
+        std::vector<std::vector<PreyState>> preyIn;
+        std::vector<std::vector<Claim>> claimsIn;
+        std::vector<std::vector<uint32_t>> birthsIn;
+        std::vector<HaloRecord> arrivals;
+        std::vector<EntityRecord> records;
+        std::vector<size_t> rows;
+        std::vector<int> ranks;
+        float preyBand = 0.0f;  // Marge des fantômes de proies pour ce tick (dépend du pas de temps)
+    } mTile;
+    
+    // 🧱 Image et lot de rendu réutilisés d'une image à l'autre
+    mutable RenderFrame mRenderFrame;
+    mutable Graphics::BatchRenderer mRenderBatch;
+    mutable Graphics::DensityTexture mDensityTexture;  // Pour Render() seulement : le moteur a la sienne
     
-    // 📊 STATISTIQUES
+    // 🗺 NIVEAU DE DÉTAIL : au-delà de mLodThreshold entités visibles, les corps
+    // cèdent la place à la carte de densité. Une fois active, ses comptes suivent les
+    // naissances, les morts et les changements de cellule des entités éveillées
+    mutable DensityMap mDensity;
+    mutable bool mDensityStale;     // État changé hors des ticks : tout recompter à la capture
+    mutable size_t mDensityCounted; // Lignes déjà comptées ; les suivantes sont nées depuis
+    mutable uint64_t mCaptureCount;
+    size_t mLodThreshold;  // 0 : toujours les corps, pas de carte
+    
+    // 📊 STATISTIQUES : populations tenues à jour à chaque apparition et retrait,
+    // naissances et morts comptées depuis le début du jour courant
     struct Statistics {
         int totalHerbivores;
         int totalCarnivores;
@@ -32,40 +138,136 @@ private:
         int deathsToday;
         int birthsToday;
     } mStats;
+    int mTickBirths;
+    int mTickDeaths;
+    // Énergie des vivants par tranche, additionnée dans l'ordre des tranches
+    struct ChunkEnergy {
+        double energy;
+        uint32_t alive;
+    };
+    std::vector<ChunkEnergy> mChunkEnergy;
+    float mMeanEnergy;
+    StatisticsHistory mHistory;  // Un échantillon par tick
 
 public:
+    static const int TICKS_PER_DAY = 3600;  // Une minute à 60 ticks/s
+
     // 🏗 CONSTRUCTEUR/DESTRUCTEUR
     Ecosystem(float width, float height, int maxEntities = 500);
     ~Ecosystem();
 
     // ⚙️ MÉTHODES PUBLIQUES
     void Initialize(int initialHerbivores, int initialCarnivores, int initialPlants);
+    void SetSeed(uint32_t seed);  // A appeler avant Initialize pour une simulation reproductible
+    void SetThreadCount(unsigned threadCount);  // 0 = un thread par cœur ; résultats identiques quel que soit le nombre
+    void SetHistoryCapacity(size_t ticks);      // Vide l'historique des statistiques
+    void SetLodThreshold(size_t visibleEntities) { mLodThreshold = visibleEntities; }  // 0 = toujours les corps
+    void SetParameters(const WorldParameters& parameters) { mEntities.parameters = parameters; }  // Métabolismes, reproduction
+    void SetDomain(TileDomain* domain) { mDomain = domain; }  // A appeler avant Initialize ; nullptr : tout le monde ici
+    void EnableFoodField(float cellSize = FOOD_FIELD_CELL_SIZE);  // A appeler avant Initialize : nourriture en champ dense
+    void SetSleepingEnabled(bool enabled);      // Régions endormies (activé par défaut) ; résultats identiques
     void Update(float deltaTime);
     void SpawnFood(int count);
-    void RemoveDeadEntities();
+    void ApplyCommands();       // Point de synchronisation : tout ce que le tick a enregistré
+    void RemoveDeadEntities();  // Morts enregistrées enterrées, compaction quand les tombes s'accumulent
+    void MarkDead(size_t index);  // Morte tout de suite, retirée au prochain point de synchronisation
     void HandleReproduction();
     void HandleEating();
     
     // 📊 GETTERS
-    int GetEntityCount() const { return mEntities.size(); }
+    int GetEntityCount() const { return static_cast<int>(LiveCount()); }  // Sans les tombes ; en tuiles, tout le monde
     int GetFoodCount() const { return mFoodSources.size(); }
+    const std::vector<Food>& GetFoodSources() const { return mFoodSources; }
+    const FoodField& GetFoodField() const { return mFoodField; }  // Inactif sans EnableFoodField
     Statistics GetStatistics() const { return mStats; }
+    const StatisticsHistory& GetHistory() const { return mHistory; }  // Derniers ticks, sans parcourir les entités
     float GetWorldWidth() const { return mWorldWidth; }
     float GetWorldHeight() const { return mWorldHeight; }
+    int GetDayCycle() const { return mDayCycle; }
+    uint64_t GetSeed() const { return mSeed; }
+    const WorldParameters& GetParameters() const { return mEntities.parameters; }
+    const EntityStore& GetEntities() const { return mEntities; }
+    Entity GetEntity(size_t index);  // Vue, valide jusqu'au prochain tick (réveille la région de l'entité)
+    const PlantSchedule& GetPlantSchedule() const { return mPlants; }
+    const WorldRegions& GetRegions() const { return mRegions; }
+    unsigned GetThreadCount() const { return mScheduler->GetThreadCount(); }
+    uint64_t ComputeChecksum() const;  // Empreinte de l'état des entités (vérification du déterminisme)
+    // Même empreinte pour des colonnes réunies d'ailleurs (tuiles rassemblées sur un rang)
+    static uint64_t ComputeChecksum(const EntityStore& entities, size_t foodCount, const FoodField& foodField);
+    
+    // 💾 INSTANTANÉS : état complet (entités, nourriture, graine, cycle, statistiques)
+    bool SaveSnapshot(const std::string& path) const;  // false (et ❌) en cas d'échec
+    bool LoadSnapshot(const std::string& path);        // Remplace l'état courant ; inchangé en cas d'échec
+    
+    // 🎞 TRACE : enregistre chaque tick dans recorder (nullptr pour arrêter) ;
+    // une première keyframe est écrite immédiatement
+    void SetTraceRecorder(TraceRecorder* recorder);
+    // Reconstruit l'état au début du tick demandé depuis la keyframe la plus proche,
+    // en rejouant les entrées enregistrées. false (et ❌) si impossible
+    bool ReplayTo(const std::string& tracePath, uint32_t tick);
+    
+    // 🔍 REQUÊTES SPATIALES (valides jusqu'au prochain RebuildSpatialIndex)
+    int FindNearestFood(Vector2D position, float radius) const;
+    void QueryPredators(Vector2D position, float radius, std::vector<uint32_t>& out) const;
+    const SpatialGrid& GetFoodGrid() const { return mFoodGrid; }
+    const SpatialGrid& GetPredatorGrid() const { return mPredatorGrid; }
+    const SpatialGrid& GetPreyGrid() const { return mPreyGrid; }
+    void RebuildSpatialIndex();
     
     // 🎯 MÉTHODES DE GESTION
     void AddEntity(std::unique_ptr<Entity> entity);
     void AddFood(Vector2D position, float energy = 25.0f);
     
     // 🎨 RENDU
-    void Render(SDL_Renderer* renderer) const;
+    void Render(SDL_Renderer* renderer, float alpha = 1.0f) const;  // alpha : interpolation entre deux ticks
+    // Copie l'état dessinable dans frame, pour un rendu sur un autre thread (entre deux ticks) ;
+    // seul ce qui touche la vue est copié, et la carte de densité n'envoie que ses cellules modifiées
+    void CaptureFrame(RenderFrame& frame, const RenderView& view = RenderView()) const;
 
 private:
     // 🔐 MÉTHODES PRIVÉES
+    bool WriteSnapshot(const std::string& path) const;
+    void WriteKeyframe();
     void UpdateStatistics();
+    void AdjustPopulation(EntityType type, int delta);
+    size_t LiveCount() const;  // Vivants comptés dans la limite d'entités (tout le monde en tuiles)
+    void GiveBirth(size_t parent);
+    void RecountPopulation();
     void SpawnRandomEntity(EntityType type);
+    void SpawnEntity(EntityType type, Vector2D position);
     Vector2D GetRandomPosition();
     void HandlePlantGrowth(float deltaTime);
+    void HandleGrazing();
+    void HandlePredation();
+    void HandleSteering();
+    template <typename S> void GatherSteering(const uint32_t* indices, size_t count, SteeringBatch& batch) const;
+    void UpdateEntities(float deltaTime);
+    void AdvancePlants(float deltaTime);
+    void UpdateRegions(float deltaTime);
+    void WakeRegionOf(size_t index);  // Réveille la région endormie de la ligne
+    void BuildAwakeRuns();
+    void ScanChunk(size_t chunk);
+    void MarkRowChanged(size_t index);  // Tranche de la ligne relevée au prochain BuildAwakeRuns
+    void InvalidateRuns() { mChunkRuns.clear(); }  // Lignes déplacées : tout relever
+    bool AwakeRowsCurrent() const;  // mAwakeRows couvre toutes les lignes éveillées
+    void SavePreviousPositions();
+    void CountDensityBirths() const;  // Lignes ajoutées depuis le dernier relevé de la carte
+    void TrackDensityMoves();         // Entités éveillées passées dans une autre cellule
+    template <typename AcceptFn> void BuildAnimalGrid(SpatialGrid& grid, AcceptFn accept);
+    void ParallelForEntities(const TaskScheduler::RangeTask& body);
+    template <typename RunFn>
+    void ParallelForAwake(RunFn body);  // body(début, fin, worker) sur chaque série éveillée
+    template <typename RunFn>
+    void ForEachAwakeRun(size_t begin, size_t end, unsigned worker, RunFn&& body) const;
+    template <typename RunFn>  // Séries runs (awake ou present) de la tranche [begin, end)
+    void ForEachRun(std::vector<uint32_t> ChunkRuns::*runs, size_t begin, size_t end, unsigned worker,
+                    RunFn&& body) const;
+    void MergeClaims(std::vector<Claim> WorkerBuffers::*buffer);  // Triées par (cible, mangeur)
+    // 🧩 Étapes en tuiles : mêmes décisions qu'en un seul processus, prises en commun
+    void ExchangeHalo(float deltaTime);
+    void ResolveFoodAcrossTiles();
+    void ResolvePredationAcrossTiles();
+    void ApplyBirthsAcrossTiles();
 };
 
 } // namespace Core
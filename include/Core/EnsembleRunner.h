@@ -0,0 +1,134 @@
+#pragma once
+#include "EntityStore.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🎛 PARAMÈTRES BALAYABLES (valeurs figées : leur ordre est celui des colonnes du fichier de résultats)
+enum class EnsembleParameter : uint32_t {
+    HERBIVORES,
+    CARNIVORES,
+    PLANTS,
+    MAX_ENTITIES,
+    METABOLISM_HERBIVORE,
+    METABOLISM_CARNIVORE,
+    METABOLISM_PLANT,
+    REPRODUCTION_CHANCE
+};
+constexpr size_t ENSEMBLE_PARAMETER_COUNT = 8;
+
+// 🧾 DESCRIPTION D'UN ENSEMBLE (fichier texte, une clé par ligne, '#' pour les commentaires)
+//   mode grid|lhs         Produit cartésien des valeurs, ou hypercube latin
+//   samples N             Points tirés par l'hypercube latin
+//   replicates N          Runs par point (graines différentes)
+//   ticks N               Durée de chaque run
+//   seed S                Graine du run i : S + i ; graine des tirages de l'hypercube
+//   width W / height H    Taille du monde
+//   dt S                  Pas de temps fixe
+//   sample-interval N     Ticks entre deux échantillons de la série temporelle
+//   food-field            Nourriture en champ dense
+//   <paramètre> v1 v2 ... Grille : valeurs essayées ; hypercube : min max
+// Paramètres : herbivores, carnivores, plants, max-entities, metabolism-herbivore,
+// metabolism-carnivore, metabolism-plant, reproduction-chance. Un paramètre
+// absent garde sa valeur par défaut (traits et ligne de commande).
+struct EnsembleSpec {
+    enum class Mode {
+        GRID,
+        LATIN_HYPERCUBE
+    };
+    struct Axis {
+        EnsembleParameter parameter;
+        std::vector<double> values;  // Grille : valeurs ; hypercube : {min, max}
+    };
+
+    Mode mode = Mode::GRID;
+    int samples = 0;
+    int replicates = 1;
+    long long ticks = 3600;
+    uint32_t seed = 1;
+    float worldWidth = 1200.0f;
+    float worldHeight = 600.0f;
+    float deltaTime = 1.0f / 60.0f;
+    int sampleInterval = 60;
+    bool foodField = false;
+    double defaults[ENSEMBLE_PARAMETER_COUNT];
+    std::vector<Axis> axes;
+
+    EnsembleSpec();
+    // 📂 Lecture du fichier ; false (et ❌ avec le numéro de ligne) si invalide
+    bool Load(const std::string& path);
+};
+
+// 🧪 UN RUN : graine et valeur de chaque paramètre
+struct EnsembleRun {
+    uint32_t index;
+    uint32_t seed;
+    double values[ENSEMBLE_PARAMETER_COUNT];
+
+    WorldParameters GetWorldParameters() const;
+};
+
+// 🧮 Liste des runs dans l'ordre (point par point, réplicats consécutifs) ;
+// fonction pure de la description : mêmes runs quel que soit le nombre de workers
+std::vector<EnsembleRun> ExpandEnsemble(const EnsembleSpec& spec);
+
+// 🏁 EXÉCUTION D'UN ENSEMBLE
+// Chaque worker possède un écosystème à la fois (un seul thread de
+// simulation) et prend le run suivant dès qu'il a fini le sien. Les séries
+// temporelles partent dans le fichier de résultats au fil de l'eau, dans
+// l'ordre des runs : un run terminé en avance attend que ses prédécesseurs
+// soient écrits. Le fichier est identique quel que soit le nombre de workers.
+//
+// 📦 FICHIER DE RÉSULTATS (binaire, ordre des octets de la machine)
+//   En-tête : EnsembleFileHeader
+//   Puis, par run : EnsembleRunHeader suivi de ses colonnes, chacune contiguë
+//   sur sampleCount valeurs : tick (u32), herbivores, carnivores, plants,
+//   births, deaths, food (i32), meanEnergy (f32). births et deaths sont
+//   cumulés sur l'intervalle qui se termine à l'échantillon.
+const char ENSEMBLE_MAGIC[8] = {'E', 'C', 'O', 'E', 'N', 'S', 'M', '\0'};
+const uint32_t ENSEMBLE_VERSION = 1;
+constexpr size_t ENSEMBLE_COLUMN_COUNT = 8;
+
+struct EnsembleFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t runCount;
+    uint32_t parameterCount;  // ENSEMBLE_PARAMETER_COUNT
+    uint32_t columnCount;     // ENSEMBLE_COLUMN_COUNT
+    uint32_t sampleInterval;
+    uint32_t reserved;
+    uint64_t ticks;
+    float deltaTime;
+    float worldWidth;
+    float worldHeight;
+    uint32_t padding;
+};
+
+struct EnsembleRunHeader {
+    uint32_t index;
+    uint32_t seed;
+    uint32_t sampleCount;
+    uint32_t reserved;
+    double values[ENSEMBLE_PARAMETER_COUNT];
+    uint64_t checksum;  // Empreinte de l'état final (Ecosystem::ComputeChecksum)
+};
+
+class EnsembleRunner {
+public:
+    struct Report {
+        size_t runs;
+        double seconds;
+        unsigned workers;
+    };
+
+    // workerCount = 0 : un worker par cœur. false (et ❌) si le fichier ne peut être écrit
+    static bool Run(const EnsembleSpec& spec, const std::string& outputPath, unsigned workerCount,
+                    Report& report);
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -1,67 +1,143 @@
-#pragma once 
-#include "Structs.h" 
-#include <SDL3/SDL.h> 
-#include <memory> 
-#include <random> 
-#include <vector> 
-namespace Ecosystem { 
-namespace Core { 
-// ÉNUMÉRATION DES TYPES D'ENTITÉS 
-enum class EntityType { 
-    HERBIVORE, 
-    CARNIVORE,
-    PLANT 
-}; 
-class Entity { 
-private: 
-    // DONNÉES PRIVÉES - État interne protégé 
-    float mEnergy; 
-    float mMaxEnergy; 
-    int mAge; 
-    int mMaxAge; 
-    bool mIsAlive; 
-    Vector2D mVelocity; 
-    EntityType mType; 
-    // Générateur aléatoire 
-    mutable std::mt19937 mRandomGenerator; 
-public: 
-    // DONNÉES PUBLIQUES - Accès direct sécurisé 
-    Vector2D position; 
-    Color color; 
-    float size; 
-    std::string name; 
-    // CONSTRUCTEURS 
-    Entity(EntityType type, Vector2D pos, std::string entityName = "Unnamed"); 
-    Entity(const Entity& other);  // Constructeur de copie 
-    // DESTRUCTEUR 
-    ~Entity(); 
-    // ⚙MÉTHODES PUBLIQUES 
-    void Update(float deltaTime); 
-    void Move(float deltaTime); 
-    void Eat(float energy); 
-    bool CanReproduce() const; 
-    std::unique_ptr<Entity> Reproduce(); 
-    void ApplyForce(Vector2D force); 
-    // GETTERS - Accès contrôlé aux données privées 
-    float GetEnergy() const { return mEnergy; } 
-    float GetEnergyPercentage() const { return mEnergy / mMaxEnergy; } 
-    int GetAge() const { return mAge; } 
-    bool IsAlive() const { return mIsAlive; } 
-    EntityType GetType() const { return mType; } 
-    Vector2D GetVelocity() const { return mVelocity; } 
-    // MÉTHODES DE COMPORTEMENT 
-    Vector2D SeekFood(const std::vector<Food>& foodSources) const; 
-    Vector2D AvoidPredators(const std::vector<Entity>& predators) const; 
-    Vector2D StayInBounds(float worldWidth, float worldHeight) const; 
-    // MÉTHODE DE RENDU 
-    void Render(SDL_Renderer* renderer) const; 
-private: 
-    // MÉTHODES PRIVÉES - Logique interne 
-    void ConsumeEnergy(float deltaTime); 
-    void Age(float deltaTime); 
-    void CheckVitality(); 
-    Vector2D GenerateRandomDirection(); 
-    Color CalculateColorBasedOnState() const; 
-}; 
-} // namespace Core 
-} // namespace Ecosystem
\ No newline at end of file
+#pragma once
+#include "Structs.h"
+#include "EntityStore.h"
+#include "EventTrace.h"
+#include "SpatialGrid.h"
+#include "Random.h"
+#include "RenderFrame.h"
+#include "../Graphics/BatchRenderer.h"
+#include <SDL3/SDL.h>
+#include <memory>
+#include <vector>
+namespace Ecosystem {
+namespace Core {
+// 📏 CONSTANTES COMMUNES À TOUTES LES ESPÈCES (le reste est dans SPECIES_TRAITS)
+const float MAX_STEERING_FORCE = 0.5f; // Force maximale de direction
+const int REPRODUCTION_MIN_AGE = 20;   // Âge à dépasser pour pouvoir se reproduire
+const float PLANT_PHOTOSYNTHESIS = 0.1f; // Énergie produite par une plante à chaque tick
+const float WANDER_CHANCE = 0.02f;     // Probabilité par tick de changer de direction au hasard
+
+// 🗂 BLOC PARTITIONNÉ PAR ESPÈCE
+// Indices des vivants d'au plus CAPACITY entités consécutives, rangés par espèce
+// (ordre croissant dans chaque espèce) : les noyaux spécialisés par Species<T>
+// parcourent ensuite chaque liste sans tester le type.
+struct SpeciesBlock {
+    static const size_t CAPACITY = 256;
+    uint32_t count[SPECIES_COUNT];
+    uint32_t index[SPECIES_COUNT][CAPACITY];
+
+    void Fill(const EntityStore& store, size_t begin, size_t end) {  // end - begin <= CAPACITY
+        for (size_t s = 0; s < SPECIES_COUNT; ++s) count[s] = 0;
+        for (size_t i = begin; i < end; ++i) {
+            if (!store.alive[i]) continue;
+            const size_t species = static_cast<size_t>(store.type[i]);
+            index[species][count[species]++] = static_cast<uint32_t>(i);
+        }
+    }
+    // function(Species<T>(), indices, count) pour chaque espèce présente dans le bloc
+    template <typename Function>
+    void ForEach(Function&& function) const {
+        ForEachSpecies([&](auto species) {
+            using S = decltype(species);
+            if (count[S::index] > 0) function(species, index[S::index], static_cast<size_t>(count[S::index]));
+        });
+    }
+};
+// 👁 VUE SUR UNE ENTITÉ
+// Les données vivent dans un EntityStore (colonnes contiguës) ; Entity n'est
+// qu'un pointeur vers le stockage et un indice dense. Une vue reste valide
+// jusqu'au prochain changement structurel du stockage (naissance, compaction).
+// Une entité construite directement (hors écosystème) possède son propre
+// stockage d'un seul emplacement, ce qui conserve l'API historique.
+class Entity {
+private:
+    EntityStore* mStore;
+    size_t mIndex;
+    std::unique_ptr<EntityStore> mOwnedStore;  // Non nul pour une entité détachée
+public:
+    // CONSTRUCTEURS
+    Entity(EntityType type, Vector2D pos, const std::string& entityName = "Unnamed");  // Entité détachée
+    Entity(EntityStore& store, size_t index);                                          // Vue dans un stockage
+    Entity(const Entity& other);  // Constructeur de copie : enfant détaché
+    Entity& operator=(const Entity&) = delete;
+    // DESTRUCTEUR
+    ~Entity();
+    // ⚙MÉTHODES PUBLIQUES
+    void Update(float deltaTime);
+    void Move(float deltaTime);
+    void Eat(float energy);
+    bool CanReproduce() const;
+    static float ReproductionRoll(const EntityStore& store, size_t index);  // Tirage du tick courant
+    std::unique_ptr<Entity> Reproduce();
+    void ApplyForce(Vector2D force);
+    size_t CopyInto(EntityStore& destination) const;  // Adoption par un autre stockage
+    // GETTERS - Accès contrôlé aux données
+    float GetEnergy() const { return mStore->EnergyOf(mIndex); }
+    float GetEnergyPercentage() const { return mStore->EnergyOf(mIndex) / mStore->maxEnergy[mIndex]; }
+    int GetAge() const { return mStore->AgeOf(mIndex); }
+    bool IsAlive() const { return mStore->alive[mIndex] != 0; }
+    EntityType GetType() const { return mStore->type[mIndex]; }
+    Vector2D GetVelocity() const { return mStore->velocity[mIndex]; }
+    Vector2D GetPosition() const { return mStore->position[mIndex]; }
+    void SetPosition(Vector2D pos) { mStore->position[mIndex] = pos; }
+    Color GetColor() const { return mStore->color[mIndex]; }
+    float GetSize() const { return mStore->size[mIndex]; }
+    std::string GetName() const { return mStore->GetName(mIndex); }  // Formaté à la demande
+    EntityId GetId() const { return mStore->id[mIndex]; }
+    EntityHandle GetHandle() const { return mStore->GetHandle(mIndex); }
+    size_t GetIndex() const { return mIndex; }
+    // MÉTHODES DE COMPORTEMENT
+    Vector2D SeekFood(const std::vector<Food>& foodSources) const;
+    Vector2D AvoidPredators(const std::vector<Entity>& predators) const;
+    // Variantes indexées : seuls les voisins renvoyés par la grille sont examinés
+    Vector2D SeekFood(const std::vector<Food>& foodSources, const SpatialGrid& foodGrid) const;
+    Vector2D AvoidPredators(const EntityStore& store, const SpatialGrid& predatorGrid) const;
+    Vector2D StayInBounds(float worldWidth, float worldHeight) const;
+    // MÉTHODE DE RENDU
+    void Render(SDL_Renderer* renderer) const;
+
+    // 🧬 CRÉATION DANS UN STOCKAGE
+    // entityName vide : nom généré "<Type>_<id>" sans allocation
+    static size_t Spawn(EntityStore& store, EntityType type, Vector2D pos, const std::string& entityName = "");
+    static size_t SpawnChild(EntityStore& destination, EntityStore& source, size_t parentIndex);
+    // ⚙️ NOYAUX PAR LOTS : une étape de vie appliquée à [begin, end) du stockage
+    // Les nouveaux morts sont ajoutés à deaths (journalisés par l'appelant, dans l'ordre des indices).
+    // Les plantes n'y consomment ni ne vieillissent : leurs horloges (store.plantClocks) s'en chargent
+    static void UpdateRange(EntityStore& store, size_t begin, size_t end, float deltaTime,
+                            std::vector<size_t>& deaths);
+    static void ConsumeEnergyRange(EntityStore& store, size_t begin, size_t end, float deltaTime);
+    static float BaseConsumption(EntityType type) { return TraitsOf(type).metabolism; }
+    static float PlantGrowth(const EntityStore& store, float deltaTime);  // Énergie gagnée par une plante en un tick (avant plafond)
+    static void AgeRange(EntityStore& store, size_t begin, size_t end, float deltaTime);
+    static int AgeIncrement(float deltaTime);  // Années ajoutées par un tick de deltaTime
+    static void MoveRange(EntityStore& store, size_t begin, size_t end, float deltaTime);
+    static void CheckVitalityRange(EntityStore& store, size_t begin, size_t end,
+                                   std::vector<size_t>& deaths);
+    static DeathCause NaturalDeathCause(const EntityStore& store, size_t index);  // Faim ou vieillesse
+    static void LogDeath(const EntityStore& store, size_t index, DeathCause cause);
+    // alpha interpole entre previousPosition (0) et position (1)
+    static void RenderRange(const EntityStore& store, size_t begin, size_t end,
+                            SDL_Renderer* renderer, float alpha = 1.0f);
+    // Ajoute corps et barres d'énergie au lot de l'image (aucun appel de dessin)
+    static void RenderRange(const EntityStore& store, size_t begin, size_t end,
+                            Graphics::BatchRenderer& batch, float alpha = 1.0f);
+    // Copie les vivants de la vue dans l'image publiée (positions, couleur d'état, barre d'énergie)
+    static void CaptureRange(const EntityStore& store, size_t begin, size_t end, const RenderView& view,
+                             RenderFrame& frame);
+private:
+    // MÉTHODES PRIVÉES - Logique interne
+    void ConsumeEnergy(float deltaTime);
+    void Age(float deltaTime);
+    void CheckVitality();
+    static Vector2D GenerateRandomDirection(RandomStream& random);
+    // 🧬 NOYAUX SPÉCIALISÉS PAR ESPÈCE (S = Species<T>) : indices d'un SpeciesBlock,
+    // les branches sur les traits sont résolues à la compilation
+    template <typename S> static void ConsumeSpecies(EntityStore& store, const uint32_t* indices, size_t count, float deltaTime);
+    template <typename S> static void AgeSpecies(EntityStore& store, const uint32_t* indices, size_t count, float deltaTime);
+    template <typename S> static void MoveSpecies(EntityStore& store, const uint32_t* indices, size_t count, float deltaTime);
+    template <typename S> static void CheckSpecies(EntityStore& store, const uint32_t* indices, size_t count,
+                                                   size_t blockBegin, uint8_t* died);
+    static Color CalculateColorBasedOnState(const EntityStore& store, size_t index);
+};
+} // namespace Core
+} // namespace Ecosystem
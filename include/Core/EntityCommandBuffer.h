@@ -0,0 +1,70 @@
+#pragma once
+#include "SpeciesTraits.h"
+#include "Structs.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 📝 TAMPON DE COMMANDES STRUCTURELLES
+// Pendant le tick, aucune phase ne change la forme des colonnes : naissances,
+// morts, apparitions et nourriture mangée sont seulement enregistrées (une voie
+// par thread, sans verrou), puis Ecosystem::ApplyCommands les applique d'un seul
+// lot au point de synchronisation de fin de tick. L'ordre d'application ne
+// dépend que des indices : naissances par parent, morts par indice, apparitions
+// dans l'ordre d'enregistrement (phases en série).
+class EntityCommandBuffer {
+public:
+    // 🛣 VOIE D'UN THREAD : un seul worker y écrit pendant une phase parallèle
+    struct Lane {
+        std::vector<size_t> births;  // Indices des parents
+        std::vector<size_t> deaths;  // Entités déjà marquées mortes (alive = 0)
+    };
+    struct SpawnCommand {
+        EntityType type;
+        Vector2D position;
+    };
+
+private:
+    std::vector<Lane> mLanes;
+    std::vector<size_t> mBirths;       // Voies réunies, triées
+    std::vector<size_t> mDeaths;
+    std::vector<size_t> mKills;        // Morts par prédation (sous-ensemble de mDeaths), triées
+    std::vector<SpawnCommand> mSpawns;
+    std::vector<uint32_t> mEatenFood;  // Indices dans les sources de nourriture, croissants
+
+public:
+    EntityCommandBuffer() : mLanes(1) {}
+
+    void SetLaneCount(size_t count) { mLanes.assign(std::max<size_t>(count, 1), Lane{}); }
+    Lane& GetLane(unsigned worker) { return mLanes[worker]; }
+
+    // ✍️ ENREGISTREMENT EN SÉRIE
+    void Kill(size_t index) {  // Proie : marquée morte par l'appelant
+        mLanes[0].deaths.push_back(index);
+        mKills.push_back(index);
+    }
+    void Spawn(EntityType type, Vector2D position) { mSpawns.push_back({type, position}); }
+    void EatFood(uint32_t food) { mEatenFood.push_back(food); }  // Par indices croissants
+
+    // 🔀 RÉUNION DES VOIES (idempotente) : même ordre quel que soit le découpage
+    void Merge();
+    void Clear();
+
+    // 🔍 COMMANDES RÉUNIES
+    const std::vector<size_t>& GetBirths() const { return mBirths; }
+    const std::vector<size_t>& GetDeaths() const { return mDeaths; }
+    const std::vector<SpawnCommand>& GetSpawns() const { return mSpawns; }
+    const std::vector<uint32_t>& GetEatenFood() const { return mEatenFood; }
+    bool IsKill(size_t index) const { return std::binary_search(mKills.begin(), mKills.end(), index); }
+    void ClearDeaths() {
+        mDeaths.clear();
+        mKills.clear();
+    }
+};
+
+} // namespace Core
+} // namespace Ecosystem
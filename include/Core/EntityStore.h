@@ -0,0 +1,216 @@
+#pragma once
+#include "Structs.h"
+#include "SpeciesTraits.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+class SnapshotWriter;
+class SnapshotReader;
+
+// 🆔 IDENTIFIANT STABLE : ne change pas quand les entités sont compactées.
+// Numéro de série unique (clé des tirages aléatoires et du nom affiché).
+using EntityId = uint32_t;
+const EntityId INVALID_ENTITY_ID = UINT32_MAX;
+
+// 🎫 POIGNÉE GÉNÉRATIONNELLE : emplacement réutilisable + génération.
+// Quand une entité meurt, la génération de son emplacement avance : une
+// poignée conservée au-delà de la mort est détectée comme périmée.
+struct EntityHandle {
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0;
+    bool operator==(const EntityHandle& other) const {
+        return slot == other.slot && generation == other.generation;
+    }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+const EntityHandle INVALID_ENTITY_HANDLE = {};
+
+// 🌱 HORLOGES DES PLANTES : sommes, tick après tick, de l'incrément d'âge et de
+// l'énergie qu'une plante gagne par tick (photosynthèse moins son métabolisme)
+struct PlantClocks {
+    int64_t age = 0;
+    double growth = 0.0;
+};
+
+// ⚙️ PARAMÈTRES RÉGLABLES DU MONDE : valeurs des traits par défaut, modifiables
+// d'un monde à l'autre (balayages de paramètres) sans toucher à la table constexpr
+constexpr float DEFAULT_REPRODUCTION_CHANCE = 0.3f;  // Chance par tick d'un parent éligible
+
+struct WorldParameters {
+    float metabolism[SPECIES_COUNT];  // Énergie dépensée par seconde, par espèce
+    float reproductionChance;
+};
+
+constexpr WorldParameters DefaultWorldParameters() {
+    WorldParameters parameters{};
+    for (size_t i = 0; i < SPECIES_COUNT; ++i) parameters.metabolism[i] = SPECIES_TRAITS[i].metabolism;
+    parameters.reproductionChance = DEFAULT_REPRODUCTION_CHANCE;
+    return parameters;
+}
+
+// 📦 ENTITÉ À PLAT : une ligne de toutes les colonnes, pour passer d'un stockage à
+// un autre stockage du même monde. Énergie et âge restent bruts, avec leurs dates
+// de dernier contact : les deux stockages tiennent les mêmes horloges, la plante
+// continue donc exactement comme si elle n'avait pas bougé. Le nom donné n'est
+// pas transporté : l'entité reprend son nom généré.
+struct EntityRecord {
+    Vector2D position;
+    Vector2D previousPosition;
+    Vector2D velocity;
+    int64_t ageMark;
+    double growthMark;
+    float energy;
+    float maxEnergy;
+    float size;
+    int age;
+    int maxAge;
+    EntityId id;
+    Color color;
+    uint16_t lineage;
+    EntityType type;
+    uint8_t alive;
+};
+
+// 🗃 STOCKAGE DES ENTITÉS EN COLONNES (Structure of Arrays)
+// Chaque attribut vit dans son propre tableau contigu, indexé par un indice
+// dense 0..Size()-1. Les boucles de simulation parcourent ainsi la mémoire
+// linéairement, sans suivre de pointeurs. L'indice dense d'une entité change
+// lors de RemoveDead(); son EntityId et sa poignée, eux, restent stables.
+// Les colonnes servent de réserve : après Reserve(), naissances et morts
+// réutilisent la capacité et les emplacements libérés sans allouer.
+// Une entité retirée devient une tombe (Bury) : morte, poignée rendue, ligne
+// laissée en place et sautée par les boucles ; RemoveDead() compacte les
+// tombes d'un coup quand elles sont assez nombreuses.
+// Les lignes restent rangées par identifiant croissant : les nouveaux
+// identifiants vont en fin de colonnes, la compaction et MergeRecords
+// conservent l'ordre. L'ordre des indices est donc celui des identifiants.
+// Les plantes évoluent en forme close : energy et age gardent leur valeur au
+// dernier contact, datée par ageMark et growthMark ; EnergyOf() et AgeOf() y
+// ajoutent ce que les horloges ont accumulé depuis. Une plante n'est donc
+// écrite qu'à sa naissance et quand on la touche (reproduction, repas).
+class EntityStore {
+public:
+    // 🔥 DONNÉES CHAUDES - lues à chaque tick
+    std::vector<Vector2D> position;
+    std::vector<Vector2D> previousPosition;  // Position au tick précédent (interpolation du rendu)
+    std::vector<Vector2D> velocity;
+    std::vector<float> energy;
+    std::vector<float> maxEnergy;
+    std::vector<int> age;
+    std::vector<int> maxAge;
+    std::vector<EntityType> type;
+    std::vector<uint8_t> alive;
+    std::vector<uint8_t> dormant;  // 1 = plante trop jeune pour se reproduire : hors des boucles du tick
+    std::vector<uint8_t> asleep;   // 1 = région endormie : hors de tout parcours du tick (jamais sauvegardé)
+
+    // 🌱 DATES DU DERNIER CONTACT (horloges des plantes, ignorées pour les animaux)
+    std::vector<int64_t> ageMark;
+    std::vector<double> growthMark;
+
+    // ❄️ DONNÉES FROIDES - rendu, reproduction, journalisation
+    std::vector<Color> color;
+    std::vector<float> size;
+    std::vector<uint32_t> nameIndex;  // 0 = nom généré "<Type>_<id>", sinon entrée de la table des noms
+    std::vector<uint16_t> lineage;    // Nombre de générations depuis l'ancêtre créé par Spawn
+    std::vector<EntityId> id;
+    std::vector<uint32_t> slot;       // Emplacement de la poignée
+
+    // 🎲 HORLOGE ALÉATOIRE : les tirages sont des fonctions de (graine, identifiant, tick)
+    uint64_t seed = 0;
+    uint32_t tick = 0;
+    PlantClocks plantClocks;
+    WorldParameters parameters = DefaultWorldParameters();
+
+private:
+    struct Slot {
+        uint32_t index;       // Indice dense (UINT32_MAX si libre)
+        uint32_t generation;
+    };
+    std::vector<Slot> mSlots;
+    std::vector<uint32_t> mFreeSlots;   // Pile d'emplacements libres
+    EntityId mNextId = 0;
+    size_t mTombstones = 0;             // Lignes enterrées depuis la dernière compaction
+
+    // 🏷 NOMS INTERNÉS : une chaîne par nom distinct, pas par entité
+    std::vector<std::string> mNames;    // mNames[0] inutilisé (nom généré)
+    std::unordered_map<std::string, uint32_t> mNameLookup;
+
+    void MoveRow(size_t from, size_t to);  // Toutes les colonnes ; la poignée suit la ligne
+    void ResizeColumns(size_t count);
+
+public:
+    // ⚙️ GESTION DES EMPLACEMENTS
+    size_t Append();                                             // Emplacement vierge, nouvel identifiant
+    size_t AppendCopy(const EntityStore& source, size_t index);  // Copie d'une entité d'un autre stockage
+    void Bury(size_t index);                                     // Tombe : poignée rendue, ligne sautée jusqu'à RemoveDead
+    size_t RemoveDead();                                         // Compaction stable des morts et des tombes, renvoie le nombre retiré
+    // Insère des entités venues d'ailleurs (triées par identifiant, absentes d'ici) à leur
+    // place dans l'ordre des identifiants ; rows[k] reçoit l'indice de records[k]
+    void MergeRecords(const std::vector<EntityRecord>& records, std::vector<size_t>& rows);
+    EntityRecord ExportRecord(size_t index) const;
+    void Clear();
+    void Reserve(size_t capacity);
+    void SavePreviousPositions() { previousPosition = position; }  // Sans allocation en régime établi
+    void SavePreviousPositions(size_t begin, size_t end) {  // Lignes [begin, end) seulement
+        std::copy(position.begin() + begin, position.begin() + end, previousPosition.begin() + begin);
+    }
+
+    // 🏷 NOMS
+    uint32_t InternName(const std::string& text);  // 0 pour une chaîne vide
+    // Écrit le nom dans buffer (tronqué, sans '\0'), renvoie la longueur écrite
+    size_t FormatName(size_t index, char* buffer, size_t capacity) const;
+    std::string GetName(size_t index) const;
+
+    // 💾 INSTANTANÉS : colonnes, poignées et noms, écrits et relus d'un bloc
+    void SaveSnapshot(SnapshotWriter& writer) const;  // Les colonnes doivent vivre jusqu'à Write()
+    bool LoadSnapshot(const SnapshotReader& reader);  // false (et ❌) si incohérent ; à appeler sur un stockage neuf
+
+    // 🔍 ACCÈS
+    size_t Size() const { return type.size(); }  // Lignes, tombes comprises
+    bool Empty() const { return type.empty(); }
+    size_t TombstoneCount() const { return mTombstones; }
+    size_t LiveSize() const { return Size() - mTombstones; }  // Les morts du tick comptent jusqu'à leur enterrement
+    bool IsTombstone(size_t index) const { return mSlots[slot[index]].index != index; }
+    EntityHandle GetHandle(size_t index) const { return {slot[index], mSlots[slot[index]].generation}; }
+    size_t IndexOf(EntityHandle handle) const;  // SIZE_MAX si la poignée est périmée
+    size_t FindId(EntityId entity) const;       // Recherche dichotomique ; SIZE_MAX si absent
+    // Prochain identifiant : plusieurs stockages d'un même monde tiennent un compteur commun
+    EntityId GetNextId() const { return mNextId; }
+    void SetNextId(EntityId next) { mNextId = next; }
+    bool IsValid(EntityHandle handle) const { return IndexOf(handle) != SIZE_MAX; }
+
+    // 🌱 ÉNERGIE ET ÂGE COURANTS (forme close pour les plantes)
+    float EnergyOf(size_t index) const {
+        return TraitsOf(type[index]).clocked ? ClockedEnergyOf(index) : energy[index];
+    }
+    int AgeOf(size_t index) const {
+        return TraitsOf(type[index]).clocked ? ClockedAgeOf(index) : age[index];
+    }
+    // Espèce à horloge connue de l'appelant (noyaux spécialisés) : sans consulter la table
+    float ClockedEnergyOf(size_t index) const {
+        const float grown = energy[index] + static_cast<float>(plantClocks.growth - growthMark[index]);
+        return std::min(grown, maxEnergy[index]);
+    }
+    int ClockedAgeOf(size_t index) const {
+        return age[index] + static_cast<int>(plantClocks.age - ageMark[index]);
+    }
+    // Écritures datées : à utiliser dès que l'entité peut être une plante
+    void SetEnergy(size_t index, float value) {
+        energy[index] = value;
+        growthMark[index] = plantClocks.growth;
+    }
+    void SetAge(size_t index, int value) {
+        age[index] = value;
+        ageMark[index] = plantClocks.age;
+    }
+};
+
+} // namespace Core
+} // namespace Ecosystem
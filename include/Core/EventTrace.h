@@ -0,0 +1,140 @@
+#pragma once
+#include "EntityStore.h"
+#include "Structs.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏷 ÉVÉNEMENTS DE LA TRACE (valeurs figées : elles sont écrites dans le fichier)
+enum class TraceEvent : uint8_t {
+    SPAWN = 0,             // entity, detail = EntityType, x/y = position
+    BIRTH = 1,             // entity = enfant, other = parent
+    DEATH = 2,             // entity, detail = DeathCause, other = âge
+    EAT = 3,               // entity, value = énergie gagnée
+    FOOD_SPAWN = 4,        // x/y = position, value = énergie
+    INPUT_RESET = 5,       // entity/other/extra = herbivores/carnivores/plantes (Initialize)
+    INPUT_SPAWN_FOOD = 6,  // entity = nombre de sources (SpawnFood)
+    INPUT_KEY = 7          // entity = touche (informatif, sans effet sur l'état)
+};
+
+enum class DeathCause : uint8_t {
+    STARVATION,
+    OLD_AGE,
+    PREDATION
+};
+
+// Événement décodé
+struct TraceRecord {
+    TraceEvent event;
+    uint8_t detail;
+    uint32_t entity;
+    uint32_t other;
+    uint32_t extra;
+    float x;
+    float y;
+    float value;
+};
+
+// Un tick décodé : les entrées utilisateur viennent avant les événements de simulation
+struct TraceTick {
+    uint32_t tick;
+    float deltaTime;
+    std::vector<TraceRecord> records;
+};
+
+// 🎞 TRACE D'ÉVÉNEMENTS DÉTERMINISTE
+// Flux compact, un bloc par tick : identifiants en delta (zigzag) et entiers
+// en varint. Toutes les keyframeInterval ticks, un instantané complet
+// (keyframe) est écrit à côté de la trace ; la reconstruction d'un tick part
+// de la keyframe la plus proche au lieu du tout début de la simulation.
+const uint32_t TRACE_VERSION = 1;
+
+class TraceRecorder {
+private:
+    std::ofstream mFile;
+    std::string mPath;
+    uint32_t mKeyframeInterval;
+    std::vector<unsigned char> mBlock;  // Événements du tick en cours
+    uint32_t mEventCount;
+    uint32_t mPreviousTick;
+    uint32_t mPreviousEntity;
+    float mPreviousDeltaTime;
+    bool mDeltaTimeKnown;
+    uint64_t mBytesWritten;
+
+public:
+    TraceRecorder();
+    ~TraceRecorder();
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    // false (et ❌) si le fichier ne peut pas être créé
+    bool Open(const std::string& path, uint64_t seed, uint32_t keyframeInterval);
+    void Close();
+    bool IsOpen() const { return mFile.is_open(); }
+
+    // ✍️ ÉVÉNEMENTS (ajoutés au bloc du tick en cours)
+    void RecordSpawn(EntityId entity, EntityType type, Vector2D position);
+    void RecordBirth(EntityId parent, EntityId child);
+    void RecordDeath(EntityId entity, DeathCause cause, int age);
+    void RecordEat(EntityId entity, float energy);
+    void RecordFoodSpawn(Vector2D position, float energy);
+    void RecordInput(TraceEvent input, uint32_t a = 0, uint32_t b = 0, uint32_t c = 0);
+    // Écrit le bloc du tick terminé
+    void EndTick(uint32_t tick, float deltaTime);
+
+    // 🔑 KEYFRAMES : état au début du tick, avant ses entrées utilisateur
+    bool IsKeyframeDue(uint32_t tick) const { return tick % mKeyframeInterval == 0; }
+    void RecordKeyframe(uint32_t tick);
+    std::string GetKeyframePath(uint32_t tick) const { return KeyframePath(mPath, tick); }
+    static std::string KeyframePath(const std::string& tracePath, uint32_t tick);
+
+    uint64_t GetBytesWritten() const { return mBytesWritten; }
+
+private:
+    void BeginRecord(TraceEvent event, uint8_t detail, uint32_t entity);
+    void Write(const unsigned char* data, size_t length);
+};
+
+// 📖 LECTURE : un premier passage indexe les keyframes, puis la lecture
+// reprend à n'importe laquelle d'entre elles
+class TraceReader {
+public:
+    struct Keyframe {
+        uint32_t tick;
+        uint64_t offset;  // Position du marqueur dans le fichier
+    };
+
+private:
+    std::ifstream mFile;
+    std::string mPath;
+    uint64_t mSeed;
+    uint32_t mKeyframeInterval;
+    std::vector<Keyframe> mKeyframes;
+    std::vector<unsigned char> mBlock;
+    uint32_t mPreviousTick;
+    float mDeltaTime;
+
+public:
+    TraceReader();
+
+    // false (et ❌) si le fichier est absent ou invalide
+    bool Open(const std::string& path);
+    uint64_t GetSeed() const { return mSeed; }
+    uint32_t GetKeyframeInterval() const { return mKeyframeInterval; }
+    const std::vector<Keyframe>& GetKeyframes() const { return mKeyframes; }
+
+    // Se place sur la dernière keyframe <= tick ; false s'il n'y en a aucune
+    bool SeekToKeyframe(uint32_t tick, uint32_t& keyframeTick);
+    // Tick suivant ; false à la fin de la trace (ou ❌ si elle est tronquée)
+    bool Next(TraceTick& out);
+    std::string GetKeyframePath(uint32_t tick) const { return TraceRecorder::KeyframePath(mPath, tick); }
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,53 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+
+namespace Ecosystem {
+namespace Core {
+
+// ⏱ PLANIFICATEUR À PAS FIXE
+// Accumule le temps réel écoulé et le convertit en un nombre entier de pas
+// de simulation de durée constante. La simulation ne voit donc jamais de
+// deltaTime variable. Deux garde-fous évitent la "spirale de la mort" : la
+// durée d'une frame est plafonnée, et au-delà de maxStepsPerFrame le retard
+// restant est abandonné (la simulation ralentit au lieu de s'emballer).
+class FixedTimestep {
+private:
+    float mStep;
+    float mMaxFrameTime;
+    int mMaxStepsPerFrame;
+    float mAccumulator;
+    long long mDroppedSteps;
+
+public:
+    // 🏗 CONSTRUCTEUR
+    explicit FixedTimestep(float step = 1.0f / 60.0f, int maxStepsPerFrame = 8, float maxFrameTime = 0.25f)
+        : mStep(step), mMaxFrameTime(maxFrameTime), mMaxStepsPerFrame(maxStepsPerFrame),
+          mAccumulator(0.0f), mDroppedSteps(0) {}
+
+    // ⚙️ Ajoute frameTime (déjà multiplié par l'échelle de temps) et renvoie
+    // le nombre de pas de simulation à exécuter pour cette frame (0 ou plus)
+    int Advance(float frameTime) {
+        mAccumulator += std::clamp(frameTime, 0.0f, mMaxFrameTime);
+        int steps = static_cast<int>(mAccumulator / mStep);
+        if (steps > mMaxStepsPerFrame) {
+            mDroppedSteps += steps - mMaxStepsPerFrame;
+            steps = mMaxStepsPerFrame;
+            mAccumulator = std::fmod(mAccumulator, mStep);  // Retard abandonné
+        } else {
+            mAccumulator -= steps * mStep;
+        }
+        return steps;
+    }
+
+    void Reset() { mAccumulator = 0.0f; }
+
+    // 📊 GETTERS
+    float GetStep() const { return mStep; }
+    float GetAlpha() const { return std::clamp(mAccumulator / mStep, 0.0f, 1.0f); }  // Facteur d'interpolation du rendu
+    float GetTimeToNextStep() const { return std::max(mStep - mAccumulator, 0.0f); }  // Temps simulé avant le prochain pas
+    long long GetDroppedSteps() const { return mDroppedSteps; }
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,97 @@
+#pragma once
+#include "Simd.h"
+#include "Structs.h"
+#include "TaskScheduler.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🌾 PARAMÈTRES PAR DÉFAUT DU CHAMP DE NOURRITURE
+const float FOOD_FIELD_CELL_SIZE = 20.0f;   // Côté d'une cellule en unités du monde
+const float FOOD_FIELD_CAPACITY = 4.0f;     // Énergie maximale d'une cellule
+const float FOOD_FIELD_REGROWTH = 0.001f;   // Fraction du manque regagnée par tick
+const float FOOD_FIELD_DIFFUSION = 0.05f;   // Part échangée avec chaque voisin par tick (≤ 0.25)
+const float FOOD_FIELD_GRAZE = 0.05f;       // Énergie broutée au plus par herbivore et par tick
+
+// 📐 FORME DU CHAMP (section d'instantané)
+struct FoodFieldShape {
+    int32_t columns;
+    int32_t rows;
+    float cellSize;
+    float capacity;
+    float regrowth;
+    float diffusion;
+};
+
+// 🌾 CHAMP DE NOURRITURE DENSE
+// Une valeur d'énergie par cellule d'une grille couvrant le monde. Chaque tick,
+// Step() diffuse la nourriture vers les cellules voisines et la fait repousser
+// vers la capacité, rangée par rangée (noyaux SSE2/AVX2, rangées en parallèle).
+// Manger et déposer ne touchent qu'une cellule : coût fixe, quelle que soit la
+// quantité de nourriture. Une bordure d'une cellule autour de la grille reçoit
+// une copie du bord avant chaque pas : aucun échange à travers les limites du monde.
+class FoodField {
+private:
+    int mColumns;
+    int mRows;
+    size_t mStride;        // mColumns + 2 (bordure)
+    float mCellSize;
+    float mInvCellSize;
+    float mCapacity;
+    float mRegrowth;
+    float mDiffusion;
+
+    std::vector<float> mCells;      // (mRows + 2) x mStride, bordure comprise
+    std::vector<float> mNext;       // Destination du pas en cours
+    std::vector<double> mRowTotals; // Somme de chaque rangée après le pas
+    double mTotal;
+
+public:
+    // 🏗 CONSTRUCTEUR (champ inactif tant que Configure n'est pas appelé)
+    FoodField();
+
+    // ⚙️ CONFIGURATION : vide le champ
+    void Configure(float worldWidth, float worldHeight, float cellSize = FOOD_FIELD_CELL_SIZE,
+                   float capacity = FOOD_FIELD_CAPACITY, float regrowth = FOOD_FIELD_REGROWTH,
+                   float diffusion = FOOD_FIELD_DIFFUSION);
+    void Configure(const FoodFieldShape& shape);
+    void Disable();
+    bool IsActive() const { return mColumns > 0; }
+    void Clear();
+    // Remplissage aléatoire reproductible : fonction de (graine, tick) seulement
+    void Fill(uint64_t seed, uint32_t tick);
+
+    // 🔄 PAS DE SIMULATION : diffusion puis repousse, toutes les cellules
+    void Step(TaskScheduler& scheduler);
+    void Step(TaskScheduler& scheduler, SimdPath path);  // Chemin imposé (tests, bancs)
+
+    // 🍽 ACCÈS EN O(1) À LA CELLULE D'UNE POSITION
+    float Consume(Vector2D position, float amount);  // Énergie réellement prise (≤ amount)
+    void Deposit(Vector2D position, float energy);
+    float Sample(Vector2D position) const { return mCells[CellOf(position)]; }
+    // Pente de l'énergie (différences centrées, par unité du monde), vers les cellules riches
+    Vector2D Gradient(Vector2D position) const;
+
+    // 📊 GETTERS
+    double GetTotal() const { return mTotal; }  // Énergie totale, tenue à jour sans parcourir la grille
+    int GetColumns() const { return mColumns; }
+    int GetRows() const { return mRows; }
+    float GetCellSize() const { return mCellSize; }
+    float GetCapacity() const { return mCapacity; }
+    FoodFieldShape GetShape() const;
+    float At(int column, int row) const { return mCells[static_cast<size_t>(row + 1) * mStride + column + 1]; }
+    // 💾 Cellules brutes, bordure comprise (instantanés, empreinte)
+    const std::vector<float>& GetCells() const { return mCells; }
+    bool SetCells(const std::vector<float>& cells);  // false (et ❌) si la taille ne correspond pas
+
+private:
+    size_t CellOf(Vector2D position) const;
+    void FillBorder();
+    void StepRows(size_t begin, size_t end, SimdPath path);
+};
+
+} // namespace Core
+} // namespace Ecosystem
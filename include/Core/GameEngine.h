@@ -1,38 +1,78 @@
 #pragma once 
 #include "../Graphics/Window.h" 
 #include "Ecosystem.h" 
+#include "SimulationConfig.h" 
+#include "FixedTimestep.h" 
+#include "CommandQueue.h" 
+#include "RenderFrame.h" 
+#include <atomic> 
 #include <chrono> 
+#include <thread> 
 namespace Ecosystem { 
 namespace Core { 
+// 🎮 MOTEUR FENÊTRÉ
+// La simulation tourne sur son propre thread et publie, entre deux ticks, une
+// image immuable de l'état (triple tampon). Le thread principal, seul autorisé
+// par SDL à lire les événements et à dessiner, affiche la dernière image reçue
+// et envoie les entrées à la simulation par une file sans verrou : une image
+// lente ne retarde pas la simulation, un tick lourd ne bloque pas l'affichage.
  class GameEngine { 
     private: 
         // ÉTAT DU MOTEUR 
+        SimulationConfig mConfig; 
         Graphics::Window mWindow; 
-        Ecosystem mEcosystem; 
-        bool mIsRunning; 
-        bool mIsPaused; 
-        float mTimeScale; 
+        Ecosystem mEcosystem;  // Touché seulement par le thread de simulation une fois lancé 
+        TraceRecorder mTrace;  // Ouvert avec --trace 
+        std::atomic<bool> mIsRunning; 
         
-    // ⏱ CHRONOMÉTRE 
-    std::chrono::high_resolution_clock::time_point mLastUpdateTime; 
-    float mAccumulatedTime; 
+    // 🧵 THREAD DE SIMULATION (seul à lire et écrire ces membres pendant Run) 
+    std::thread mSimulationThread; 
+    bool mIsPaused; 
+    float mTimeScale; 
+    bool mFramePending;  // État modifié depuis la dernière image publiée 
+    std::chrono::steady_clock::time_point mLastUpdateTime; 
+    FixedTimestep mTimestep;  // Pas de simulation fixes, interpolation du rendu 
+    RenderView mCaptureView;  // Dernière vue reçue : les images ne contiennent qu'elle 
+    
+    // 🔗 ÉCHANGES ENTRE LES THREADS 
+    CommandQueue mCommands;       // Interface → simulation 
+    RenderFrameExchange mFrames;  // Simulation → rendu 
+    
+    // 🖼 THREAD PRINCIPAL (événements et rendu) 
+    Graphics::BatchRenderer mRenderBatch; 
+    Graphics::DensityTexture mDensityTexture;  // Carte de densité, mise à jour par les images reçues 
+    RenderView mView;  // Caméra : molette ou +/- pour zoomer, la simulation en reçoit une copie 
+    float mZoom;       // 1 : monde entier 
+    bool mShowProfiler;  // Touche P : répartition du temps d'image 
+    double mAverageRenderMs;  // Moyenne glissante de l'intervalle entre deux images affichées 
+    std::chrono::steady_clock::time_point mLastRenderTime; 
 public: 
     // 🏗 CONSTRUCTEUR 
     GameEngine(const std::string& title, float width, float height); 
+    GameEngine(const std::string& title, const SimulationConfig& config); 
+     
+    ~GameEngine(); 
      
     // ⚙MÉTHODES PRINCIPALES 
     bool Initialize(); 
-    void Run(); 
+    void Run();  // Lance le thread de simulation et affiche jusqu'à la fermeture 
     void Shutdown(); 
      
-    // GESTION D'ÉVÉNEMENTS 
+    // GESTION D'ÉVÉNEMENTS (thread principal) 
     void HandleEvents(); 
     void HandleInput(SDL_Keycode key); 
+    void ZoomAt(float factor, float screenX, float screenY);  // Garde le point du monde sous (screenX, screenY) 
 private: 
-    // MÉTHODES INTERNES 
+    // MÉTHODES INTERNES DU THREAD DE SIMULATION 
+    void SimulationLoop(); 
+    void ApplyCommand(const SimulationCommand& command); 
     void Update(float deltaTime); 
-    void Render(); 
-    void RenderUI(); 
+    void PublishFrame(); 
+    void StopSimulation(); 
+    // MÉTHODES INTERNES DU THREAD PRINCIPAL 
+    void Render(const RenderFrame* frame); 
+    void PaceFrame(std::chrono::steady_clock::time_point frameStart); 
+    void RenderUI(const RenderFrame& frame); 
 }; 
 } // namespace Core 
 } // namespace Ecosystem
\ No newline at end of file
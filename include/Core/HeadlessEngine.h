@@ -0,0 +1,40 @@
+#pragma once
+#include "Ecosystem.h"
+#include "SimulationConfig.h"
+
+namespace Ecosystem {
+namespace Core {
+
+// 🖥 MOTEUR SANS FENÊTRE
+// Fait avancer Ecosystem::Update à pas fixe, sans fenêtre ni renderer SDL,
+// pendant un nombre de ticks et/ou un budget de temps réel. Sert aux
+// serveurs sans affichage et à la mesure du débit brut de la simulation.
+class HeadlessEngine {
+private:
+    SimulationConfig mConfig;
+    Ecosystem mEcosystem;
+    TraceRecorder mTrace;
+
+public:
+    // 📊 RÉSULTAT D'UNE EXÉCUTION
+    struct RunReport {
+        long long ticks;
+        double elapsedSeconds;
+        double ticksPerSecond;
+        double entityUpdatesPerSecond;  // Somme des populations par tick / durée
+    };
+
+    // 🏗 CONSTRUCTEUR
+    explicit HeadlessEngine(const SimulationConfig& config);
+
+    // ⚙️ MÉTHODES PRINCIPALES
+    bool Initialize();  // false si l'instantané, la trace ou la reconstruction demandés échouent
+    RunReport Run();
+    void PrintReport(const RunReport& report) const;
+
+    // 📊 GETTERS
+    const Ecosystem& GetEcosystem() const { return mEcosystem; }
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,204 @@
+#pragma once
+#include "EntityStore.h"
+#include "Structs.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// 🔧 NIVEAU MINIMAL À LA COMPILATION : les messages en dessous disparaissent du binaire
+// (0 = TRACE ... 5 = NONE), ex. -DECOSYSTEM_LOG_LEVEL=2 pour une version de mesure
+#ifndef ECOSYSTEM_LOG_LEVEL
+#define ECOSYSTEM_LOG_LEVEL 0
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+enum class LogLevel : uint8_t {
+    TRACE,
+    DEBUG,
+    INFO,
+    WARNING,
+    ERROR,
+    NONE
+};
+
+// Niveau gardé à la compilation (sans comparaison toujours vraie au niveau 0)
+constexpr bool LogLevelEnabled(LogLevel level) {
+#if ECOSYSTEM_LOG_LEVEL > 0
+    return static_cast<int>(level) >= ECOSYSTEM_LOG_LEVEL;
+#else
+    return (void)level, true;
+#endif
+}
+
+// 🏷 ÉVÉNEMENTS STRUCTURÉS (mode binaire)
+enum class LogEvent : uint8_t {
+    ENTITY_SPAWNED,
+    ENTITY_BORN,
+    ENTITY_ATE,
+    ENTITY_DIED,
+    ENTITY_REMOVED
+};
+
+// Enregistrement binaire tel qu'écrit dans le fichier (little-endian, 28 octets)
+struct LogEventRecord {
+    uint64_t sequence;  // Ordre global d'émission
+    uint32_t entity;
+    LogEvent event;
+    LogLevel level;
+    EntityType entityType;
+    uint8_t detail;     // ENTITY_DIED : cause du décès (DeathCause), 0 sinon
+    float x;
+    float y;
+    float value;        // Énergie gagnée, âge au décès...
+};
+
+// 📝 JOURNAL ASYNCHRONE
+// Chaque thread écrit dans son propre anneau (un producteur, un consommateur,
+// sans verrou) ; un thread d'écriture vide les anneaux en arrière-plan et
+// formate la sortie. Le chemin chaud ne fait qu'une copie en mémoire : aucun
+// appel système, aucun flush. Si un anneau est plein, le message est compté
+// comme perdu plutôt que de bloquer la simulation.
+class Logger {
+public:
+    static const size_t RING_CAPACITY = 4096;    // Enregistrements par thread (puissance de 2)
+    static const size_t MAX_MESSAGE_LENGTH = 232;
+
+    struct Record {
+        uint64_t sequence;
+        LogLevel level;
+        bool isEvent;
+        uint16_t length;
+        union {
+            char text[MAX_MESSAGE_LENGTH];
+            LogEventRecord event;
+        };
+    };
+
+private:
+    struct ThreadRing {
+        Record records[RING_CAPACITY];
+        std::atomic<size_t> head{0};  // Écrit par le producteur
+        std::atomic<size_t> tail{0};  // Écrit par le thread d'écriture
+        std::atomic<bool> owned{false};
+    };
+
+    static std::atomic<uint8_t> sLevel;
+    static std::atomic<bool> sBinaryEvents;
+
+    std::mutex mRingsMutex;
+    std::vector<std::unique_ptr<ThreadRing>> mRings;
+    std::atomic<uint64_t> mSequence;
+    std::atomic<uint64_t> mDropped;
+
+    std::thread mWriter;
+    std::mutex mWakeMutex;
+    std::condition_variable mWakeCondition;
+    std::condition_variable mFlushedCondition;
+    uint64_t mFlushRequested;
+    uint64_t mFlushCompleted;
+    bool mStopping;
+
+    std::ofstream mEventFile;
+    std::vector<Record> mBatch;  // Tampon du thread d'écriture
+
+public:
+    static Logger& Instance();
+    ~Logger();
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    // ⚙️ CONFIGURATION
+    static void SetLevel(LogLevel level) { sLevel.store(static_cast<uint8_t>(level), std::memory_order_relaxed); }
+    static LogLevel GetLevel() { return static_cast<LogLevel>(sLevel.load(std::memory_order_relaxed)); }
+    static bool IsEnabled(LogLevel level) {
+        return static_cast<uint8_t>(level) >= sLevel.load(std::memory_order_relaxed);
+    }
+    // Les événements d'entité sont écrits en binaire dans path ; false (et ❌) si impossible.
+    // À appeler avant de lancer la simulation.
+    bool OpenEventFile(const std::string& path);
+    static bool IsBinaryEvents() { return sBinaryEvents.load(std::memory_order_relaxed); }
+
+    // ✍️ ÉCRITURE (appelées par LogLine et LogEntityEvent)
+    Record* Reserve(LogLevel level);  // nullptr si l'anneau est plein
+    void Commit();
+    // Attend que tout ce qui a été écrit avant l'appel soit sorti
+    void Flush();
+    uint64_t GetDroppedCount() const { return mDropped.load(std::memory_order_relaxed); }
+
+    static const char* LevelName(LogLevel level);
+    static bool ParseLevel(const std::string& name, LogLevel& out);
+
+private:
+    Logger();
+    ThreadRing& RingForThisThread();
+    void WriterLoop();
+    bool Drain();
+    void Output(const Record& record);
+};
+
+// 🧵 Ligne de texte en cours : formatée directement dans l'anneau du thread
+class LogLine {
+private:
+    Logger::Record* mRecord;
+
+public:
+    explicit LogLine(LogLevel level) : mRecord(Logger::Instance().Reserve(level)) {}
+    ~LogLine() {
+        if (mRecord) Logger::Instance().Commit();
+    }
+    LogLine(const LogLine&) = delete;
+    LogLine& operator=(const LogLine&) = delete;
+
+    LogLine& operator<<(const char* text);
+    LogLine& operator<<(std::string_view text);
+    LogLine& operator<<(char value);
+    LogLine& operator<<(int value);
+    LogLine& operator<<(long value);
+    LogLine& operator<<(long long value);
+    LogLine& operator<<(unsigned value);
+    LogLine& operator<<(unsigned long value);
+    LogLine& operator<<(unsigned long long value);
+    LogLine& operator<<(double value);
+
+private:
+    void Append(const char* data, size_t length);
+};
+
+// 🏷 Événement d'entité : enregistrement binaire si un fichier d'événements est
+// ouvert, sinon message texte équivalent à l'ancien journal
+void LogEntityEvent(LogLevel level, LogEvent event, const EntityStore& store, size_t index,
+                    float value = 0.0f, uint8_t detail = 0);
+
+} // namespace Core
+} // namespace Ecosystem
+
+// 📝 ECO_LOG(LogLevel::INFO, "texte " << valeur) : rien n'est évalué si le niveau est filtré
+#define ECO_LOG(level, expression)                                                          \
+    do {                                                                                    \
+        if constexpr (::Ecosystem::Core::LogLevelEnabled(level)) {                          \
+            if (::Ecosystem::Core::Logger::IsEnabled(level)) {                              \
+                ::Ecosystem::Core::LogLine ecoLogLine(level);                               \
+                ecoLogLine << expression;                                                   \
+            }                                                                               \
+        }                                                                                   \
+    } while (0)
+
+// 🏷 ECO_LOG_EVENT(LogLevel::DEBUG, LogEvent::ENTITY_DIED, store, index, valeur[, détail])
+#define ECO_LOG_EVENT(level, event, store, index, ...)                                      \
+    do {                                                                                    \
+        if constexpr (::Ecosystem::Core::LogLevelEnabled(level)) {                          \
+            if (::Ecosystem::Core::Logger::IsEnabled(level)) {                              \
+                ::Ecosystem::Core::LogEntityEvent(level, event, store, index, __VA_ARGS__); \
+            }                                                                               \
+        }                                                                                   \
+    } while (0)
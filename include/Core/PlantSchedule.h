@@ -0,0 +1,43 @@
+#pragma once
+#include "EntityStore.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🌱 ÉCHÉANCIER DES PLANTES
+// L'âge d'une plante ne dépend que de l'horloge store.plantClocks.age : sa
+// maturité (âge de reproduction) et sa mort de vieillesse tombent donc à une
+// valeur d'horloge connue dès sa naissance. Deux files de priorité rangent ces
+// échéances ; chaque tick ne dépile que celles qui sont dues, au lieu de
+// parcourir toutes les plantes. Une plante immature reste marquée dormant.
+class PlantSchedule {
+private:
+    struct Event {
+        int64_t due;  // Valeur de plantClocks.age à laquelle l'événement tombe
+        EntityHandle handle;
+        bool operator>(const Event& other) const { return due > other.due; }
+    };
+    using Queue = std::priority_queue<Event, std::vector<Event>, std::greater<Event>>;
+    Queue mMaturity;
+    Queue mDeaths;
+
+public:
+    // Inscrit la plante d'indice index (naissance, chargement) et fixe son état dormant
+    void Schedule(EntityStore& store, size_t index);
+    void Rebuild(EntityStore& store);  // Toutes les plantes vivantes du stockage
+    void Clear();
+
+    // Applique les échéances atteintes par l'horloge : réveil des plantes mûres
+    // (indice ajouté à matured), mort des plus vieilles (alive à 0, indice ajouté à deaths)
+    void Advance(EntityStore& store, std::vector<size_t>& deaths, std::vector<size_t>& matured);
+
+    size_t GetPendingCount() const { return mMaturity.size() + mDeaths.size(); }
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,147 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// 🔧 ZONES DE MESURE À LA COMPILATION : -DECOSYSTEM_PROFILING=0 les retire du binaire
+#ifndef ECOSYSTEM_PROFILING
+#define ECOSYSTEM_PROFILING 1
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+// ⏱ PROFILEUR PAR ZONES
+// Chaque zone (ECO_PROFILE_ZONE) note son début et sa fin dans le tampon de
+// son thread, sans verrou ni allocation en régime établi. Une fois par image,
+// EndFrame() agrège les zones du thread qui l'appelle (celui de la simulation)
+// en moyennes glissantes (affichées par GameEngine::RenderUI) et vide les
+// tampons, sauf pendant une capture, exportée au format trace_event de
+// Chrome (chrome://tracing, Perfetto).
+// Désactivé à l'exécution par défaut : une zone ne coûte alors qu'une lecture atomique.
+class Profiler {
+public:
+    static const size_t HISTORY_FRAMES = 120;  // Fenêtre des moyennes glissantes
+
+    struct ZoneTiming {
+        const char* name;
+        int depth;         // Imbrication dans le thread principal (0 = zone racine)
+        double lastMs;     // Durée cumulée pendant la dernière image
+        double averageMs;  // Moyenne sur les HISTORY_FRAMES dernières images
+    };
+
+    struct Record {
+        const char* name;  // Littéral : seul le pointeur est conservé
+        uint64_t start;    // Nanosecondes depuis la création du profileur
+        uint64_t end;
+        uint32_t depth;
+    };
+
+    struct ThreadBuffer {
+        std::vector<Record> records;
+        size_t aggregated = 0;  // Enregistrements déjà comptés dans les moyennes
+        uint32_t depth = 0;
+        uint32_t index = 0;     // Identifiant du thread dans la trace
+        std::atomic<bool> owned{false};
+    };
+
+private:
+    struct ZoneSeries {
+        const char* name;
+        int depth;
+        double history[HISTORY_FRAMES];
+        double sum;
+        double last;
+    };
+
+    static std::atomic<bool> sEnabled;
+    static thread_local bool tMuted;
+
+    std::mutex mBuffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> mBuffers;
+    const uint64_t mOrigin;
+
+    bool mCapturing;
+    bool mCaptureTruncated;
+    size_t mCaptureLimit;
+
+    std::vector<ZoneSeries> mSeries;
+    std::vector<ZoneTiming> mBreakdown;
+    double mFrameHistory[HISTORY_FRAMES];
+    double mFrameSum;
+    uint64_t mFrameCount;
+    uint64_t mLastFrameEnd;
+
+public:
+    static Profiler& Instance();
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // ⚙️ CONFIGURATION
+    static void SetEnabled(bool enabled) { sEnabled.store(enabled, std::memory_order_relaxed); }
+    static bool IsEnabled() { return sEnabled.load(std::memory_order_relaxed); }
+    // Le thread appelant n'enregistre plus de zone (thread de rendu, qui tourne pendant EndFrame)
+    static void MuteThisThread(bool muted) { tMuted = muted; }
+    static bool IsRecording() { return IsEnabled() && !tMuted; }
+
+    // 🎞 CAPTURE : les zones sont conservées d'une image à l'autre jusqu'à maxEvents
+    void BeginCapture(size_t maxEvents = 2000000);
+    // Écrit la capture au format JSON trace_event ; false (et ❌) si impossible
+    bool EndCapture(const std::string& path);
+    bool IsCapturing() const { return mCapturing; }
+
+    // 🖼 FIN D'IMAGE : à appeler depuis le thread de simulation, threads de travail au repos ;
+    // aucun autre thread ne doit enregistrer de zone pendant ce temps
+    void EndFrame();
+    const std::vector<ZoneTiming>& GetBreakdown() const { return mBreakdown; }
+    double GetAverageFrameMs() const;
+
+    // Utilisés par ProfileZone
+    ThreadBuffer& BufferForThisThread();
+    uint64_t Now() const;
+
+private:
+    Profiler();
+    void AggregateFrame(ThreadBuffer& main);
+};
+
+// 📍 Zone mesurée de la construction à la destruction
+class ProfileZone {
+private:
+    Profiler::ThreadBuffer* mBuffer;
+    const char* mName;
+    uint64_t mStart;
+
+public:
+    explicit ProfileZone(const char* name) : mBuffer(nullptr), mName(name), mStart(0) {
+        if (!Profiler::IsRecording()) return;
+        Profiler& profiler = Profiler::Instance();
+        mBuffer = &profiler.BufferForThisThread();
+        ++mBuffer->depth;
+        mStart = profiler.Now();
+    }
+    ~ProfileZone() {
+        if (!mBuffer) return;
+        const uint64_t end = Profiler::Instance().Now();
+        --mBuffer->depth;
+        mBuffer->records.push_back({mName, mStart, end, mBuffer->depth});
+    }
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+};
+
+} // namespace Core
+} // namespace Ecosystem
+
+// 📍 ECO_PROFILE_ZONE("Ecosystem::Update") : mesure jusqu'à la fin du bloc courant
+#if ECOSYSTEM_PROFILING
+#define ECO_PROFILE_CONCAT_INNER(a, b) a##b
+#define ECO_PROFILE_CONCAT(a, b) ECO_PROFILE_CONCAT_INNER(a, b)
+#define ECO_PROFILE_ZONE(name) ::Ecosystem::Core::ProfileZone ECO_PROFILE_CONCAT(ecoProfileZone, __LINE__)(name)
+#else
+#define ECO_PROFILE_ZONE(name) do {} while (0)
+#endif
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🎲 GÉNÉRATEUR À COMPTEUR (Philox4x32-10, Salmon et al. 2011)
+// Un nombre aléatoire est une fonction pure de (clé, compteur) : aucun état
+// à stocker par entité, aucune synchronisation entre threads, et une même
+// graine de monde redonne exactement la même simulation.
+// Compteur utilisé dans la simulation : (entité, tick, usage, tirage).
+
+// 🏷 USAGES : chaque usage a son propre flux, indépendant des autres
+enum class RandomPurpose : uint32_t {
+    SPAWN_DIRECTION,   // Direction initiale d'une entité
+    WANDER,            // Chance de changer de direction
+    WANDER_DIRECTION,  // Nouvelle direction
+    REPRODUCTION,      // Chance de reproduction
+    WORLD,             // Tirages du monde (positions des nouvelles entités)
+    PLANT_GROWTH,      // Chance et position d'une nouvelle plante
+    FOOD_FIELD,        // Remplissage initial du champ de nourriture (une suite par rangée)
+    ENSEMBLE_SAMPLE    // Strates et positions de l'hypercube latin (un flux par paramètre)
+};
+
+// Identifiant d'entité réservé aux tirages du monde
+const uint32_t WORLD_RANDOM_ENTITY = 0xFFFFFFFFu;
+
+struct PhiloxBlock {
+    uint32_t v[4];
+};
+
+inline PhiloxBlock Philox4x32(uint32_t c0, uint32_t c1, uint32_t c2, uint32_t c3, uint64_t key) {
+    const uint32_t M0 = 0xD2511F53u, M1 = 0xCD9E8D57u;
+    const uint32_t W0 = 0x9E3779B9u, W1 = 0xBB67AE85u;
+    uint32_t k0 = static_cast<uint32_t>(key);
+    uint32_t k1 = static_cast<uint32_t>(key >> 32);
+    for (int round = 0; round < 10; ++round) {
+        const uint64_t p0 = static_cast<uint64_t>(M0) * c0;
+        const uint64_t p1 = static_cast<uint64_t>(M1) * c2;
+        const uint32_t hi0 = static_cast<uint32_t>(p0 >> 32), lo0 = static_cast<uint32_t>(p0);
+        const uint32_t hi1 = static_cast<uint32_t>(p1 >> 32), lo1 = static_cast<uint32_t>(p1);
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+        k0 += W0;
+        k1 += W1;
+    }
+    return PhiloxBlock{{c0, c1, c2, c3}};
+}
+
+// Flottant uniforme dans [0, 1) à partir des 24 bits de poids fort
+inline float ToUnitFloat(uint32_t bits) {
+    return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+// 🌊 FLUX DE TIRAGES : quelques octets sur la pile, recréé à la demande
+class RandomStream {
+private:
+    uint64_t mKey;
+    uint32_t mEntity;
+    uint32_t mTick;
+    uint32_t mPurpose;
+    uint32_t mBlock;       // Indice du bloc de 4 valeurs
+    PhiloxBlock mBuffer;
+    int mAvailable;
+
+public:
+    RandomStream(uint64_t seed, uint32_t entity, uint32_t tick, RandomPurpose purpose)
+        : mKey(seed), mEntity(entity), mTick(tick), mPurpose(static_cast<uint32_t>(purpose)),
+          mBlock(0), mBuffer{{0, 0, 0, 0}}, mAvailable(0) {}
+
+    uint32_t NextUInt() {
+        if (mAvailable == 0) {
+            mBuffer = Philox4x32(mEntity, mTick, mPurpose, mBlock++, mKey);
+            mAvailable = 4;
+        }
+        return mBuffer.v[4 - mAvailable--];
+    }
+    float NextFloat() { return ToUnitFloat(NextUInt()); }
+    float Uniform(float min, float max) { return min + (max - min) * NextFloat(); }
+};
+
+// 📦 TIRAGES PAR LOTS (boucles sans dépendance, vectorisables)
+// out[i] = tirage n° draw du flux (ids[i], tick, purpose)
+void FillUniform(uint64_t seed, uint32_t tick, RandomPurpose purpose,
+                 const uint32_t* ids, size_t count, float* out, uint32_t draw = 0);
+// out[i] = i-ème tirage du flux (entity, tick, purpose)
+void FillUniformSequence(uint64_t seed, uint32_t entity, uint32_t tick, RandomPurpose purpose,
+                         size_t count, float* out);
+
+} // namespace Core
+} // namespace Ecosystem
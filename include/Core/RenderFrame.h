@@ -0,0 +1,123 @@
+#pragma once
+#include "Structs.h"
+#include "Profiler.h"
+#include "../Graphics/BatchRenderer.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🔭 VUE : rectangle du monde affiché et échelle de l'écran
+struct RenderView {
+    float x = 0.0f;       // Coin haut gauche, en unités du monde
+    float y = 0.0f;
+    float width = 0.0f;   // 0 : monde entier, sans découpe
+    float height = 0.0f;
+    float scale = 1.0f;   // Pixels par unité du monde
+
+    bool IsWhole() const { return width <= 0.0f || height <= 0.0f; }
+    bool Contains(Vector2D point, float margin) const {
+        return IsWhole() || (point.x >= x - margin && point.x <= x + width + margin &&
+                             point.y >= y - margin && point.y <= y + height + margin);
+    }
+};
+
+// 🗺 CELLULES DE LA CARTE DE DENSITÉ MODIFIÉES DEPUIS L'IMAGE PRÉCÉDENTE
+struct DensityPatch {
+    struct Region {
+        int x;          // Rectangle en cellules
+        int y;
+        int width;
+        int height;
+        size_t offset;  // Premier pixel dans pixels
+    };
+    int columns = 0;       // Géométrie de la carte entière (0 : pas de carte)
+    int rows = 0;
+    float cellSize = 0.0f;
+    std::vector<Region> regions;   // Suites de tuiles modifiées (aucune : rien à envoyer)
+    std::vector<uint32_t> pixels;  // RGBA8888, région après région, rangée par rangée
+};
+
+// 🖼 IMAGE PUBLIÉE PAR LA SIMULATION
+// Tout ce qu'il faut pour dessiner un état, copié entre deux ticks : le
+// thread de rendu ne lit jamais l'écosystème. Les colonnes ne rétrécissent
+// pas d'une capture à l'autre : en régime établi, capturer n'alloue rien.
+struct RenderFrame {
+    struct Rect {
+        float x;
+        float y;
+        float width;
+        float height;
+        Color color;
+    };
+
+    // 🌾 Fond : cellules du champ et sources de nourriture, déjà réduites à des rectangles
+    std::vector<Rect> background;
+
+    // 🐾 Entités vivantes dans la vue, interpolées au dessin (aucune si detail vaut 0)
+    std::vector<Vector2D> previousPosition;
+    std::vector<Vector2D> position;
+    std::vector<float> size;
+    std::vector<Color> color;
+    std::vector<float> energyBar;  // Fraction d'énergie ; négative : pas de barre (plantes)
+
+    // 🗺 Niveau de détail : 1 = corps seuls, 0 = carte de densité seule, entre les deux fondu
+    float detail = 1.0f;
+    size_t visibleEntities = 0;
+    DensityPatch density;
+
+    // ⏱ Horloge : alpha au moment de la capture, qui avance ensuite en temps réel
+    uint64_t serial = 0;  // Numéro de capture : une image n'envoie sa carte qu'une fois
+    uint32_t tick = 0;
+    float worldWidth = 0.0f;
+    float worldHeight = 0.0f;
+    float alpha = 1.0f;
+    double stepSeconds = 0.0;  // Durée réelle d'un pas ; 0 : simulation en pause
+    std::chrono::steady_clock::time_point capturedAt;
+
+    // 📊 Profil de la simulation (le profileur appartient au thread de simulation)
+    std::vector<Profiler::ZoneTiming> zones;
+    double simulationFrameMs = 0.0;
+
+    void ClearEntities();
+    size_t GetEntityCount() const { return position.size(); }
+    // Alpha d'interpolation à l'instant now, borné à [0, 1]
+    float AlphaAt(std::chrono::steady_clock::time_point now) const;
+    // Ajoutent au lot de l'image, dans la vue (aucun appel de dessin) : le fond,
+    // puis corps et barres d'énergie, estompés selon detail
+    void DrawBackground(Graphics::BatchRenderer& batch, const RenderView& view) const;
+    void DrawEntities(Graphics::BatchRenderer& batch, float drawAlpha, const RenderView& view) const;
+};
+
+// 🔁 TRIPLE TAMPON D'IMAGES (un producteur, un consommateur, sans verrou)
+// La simulation remplit l'image arrière puis l'échange avec celle du milieu ;
+// le rendu échange l'image du milieu avec la sienne seulement si elle est
+// nouvelle. Aucun des deux n'attend l'autre, et une image prise par le rendu
+// reste immuable jusqu'à son prochain Acquire().
+class RenderFrameExchange {
+private:
+    static const uint8_t FRESH = 4;  // Bit ajouté à l'indice du milieu : image pas encore prise
+
+    RenderFrame mFrames[3];
+    std::atomic<uint8_t> mMiddle;
+    uint8_t mBack;       // Côté simulation
+    uint8_t mFront;      // Côté rendu
+    bool mHasFrame;      // Côté rendu : au moins une image reçue
+
+public:
+    RenderFrameExchange() : mMiddle(1), mBack(0), mFront(2), mHasFrame(false) {}
+
+    // 📤 PRODUCTEUR
+    RenderFrame& GetBack() { return mFrames[mBack]; }
+    void Publish();
+    bool HasUnread() const { return (mMiddle.load(std::memory_order_acquire) & FRESH) != 0; }
+
+    // 📥 CONSOMMATEUR : image la plus récente, nullptr tant qu'aucune n'est publiée
+    const RenderFrame* Acquire();
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ⚡ JEUX D'INSTRUCTIONS x86 : SSE2 fait partie de x86-64, AVX2 est choisi à l'exécution.
+// Les fichiers de noyaux incluent <immintrin.h> sous ECO_SIMD_X86 et compilent
+// leurs fonctions AVX2 avec ECO_TARGET_AVX2 (sans option de compilation globale).
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define ECO_SIMD_X86 1
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ECO_SIMD_SSE2 1
+#endif
+#if defined(__GNUC__) || defined(__clang__)
+#define ECO_SIMD_AVX2 1
+#define ECO_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER)
+#define ECO_SIMD_AVX2 1
+#define ECO_TARGET_AVX2
+#endif
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+// ⚡ CHEMIN DES NOYAUX VECTORIELS (steering, champ de nourriture)
+enum class SimdPath : uint8_t {
+    AUTO = 0,  // Le meilleur disponible sur ce processeur
+    SCALAR,
+    SSE2,      // 4 flottants par instruction
+    AVX2       // 8 flottants par instruction
+};
+
+bool ParseSimdPath(const std::string& text, SimdPath& out);
+const char* SimdPathName(SimdPath path);
+SimdPath DetectSimdPath();                 // Meilleur chemin pris en charge par le processeur
+bool SetSimdPath(SimdPath path);           // false (et ❌) si le processeur ne le prend pas en charge
+SimdPath GetSimdPath();                    // Chemin effectivement utilisé (jamais AUTO)
+
+} // namespace Core
+} // namespace Ecosystem
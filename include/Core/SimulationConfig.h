@@ -0,0 +1,81 @@
+#pragma once
+#include "Logger.h"
+#include "Simd.h"
+#include "DensityMap.h"
+#include <cstdint>
+#include <string>
+
+namespace Ecosystem {
+namespace Core {
+
+// ⚙️ PARAMÈTRES DE LANCEMENT (remplis par la ligne de commande)
+struct SimulationConfig {
+    // 🌍 Monde
+    float worldWidth = 1200.0f;
+    float worldHeight = 600.0f;
+    int maxEntities = 500;
+    int initialHerbivores = 20;
+    int initialCarnivores = 5;
+    int initialPlants = 30;
+    uint32_t seed = 0;
+    bool hasSeed = false;  // Sans --seed, la graine vient de std::random_device
+    unsigned threadCount = 0;  // Threads de simulation, 0 = un par cœur
+    bool foodField = false;    // Nourriture en champ dense plutôt qu'en sources discrètes
+    float foodCellSize = 20.0f;
+    bool sleepingRegions = true;  // Régions calmes endormies (résultats identiques, --no-sleep pour comparer)
+
+    // 🖥 Mode sans fenêtre
+    bool headless = false;
+    long long maxTicks = 0;         // 0 = pas de limite en ticks
+    double timeBudgetSeconds = 0.0; // 0 = pas de limite en temps
+    float fixedDeltaTime = 1.0f / 60.0f;
+    bool verbose = false;           // Journal des entités (niveau debug)
+
+    // 📝 Journal
+    LogLevel logLevel = LogLevel::INFO;  // Sans --log-level : warning sans fenêtre, debug avec --verbose
+    bool hasLogLevel = false;
+    std::string eventLogPath;            // Événements d'entité en binaire (vide = texte)
+
+    // 💾 Instantanés
+    std::string loadSnapshotPath;  // Reprise depuis un instantané au lieu d'Initialize
+    std::string saveSnapshotPath;  // Sans fenêtre : écrit en fin d'exécution ; fenêtré : touche S
+
+    // 🎞 Trace d'événements et reconstruction
+    std::string tracePath;           // Enregistre chaque tick (et des keyframes à côté)
+    int keyframeInterval = 600;      // Ticks entre deux keyframes
+    std::string replayPath;          // Sans fenêtre : reconstruit replayTick depuis cette trace
+    long long replayTick = 0;
+
+    // ⚡ Noyaux vectoriels (résultats identiques quel que soit le chemin)
+    SimdPath simdPath = SimdPath::AUTO;
+
+    // 📈 Historique des statistiques
+    std::string statsHistoryPath;  // CSV des derniers ticks, écrit en fin d'exécution
+    int statsHistoryTicks = 3600;  // Capacité de l'historique
+
+    // ⏱ Profilage
+    std::string profilePath;  // Trace Chrome (trace_event) des zones mesurées, écrite en fin d'exécution
+
+    // 🧪 Ensemble de runs indépendants (balayage de paramètres)
+    std::string ensemblePath;                      // Description de l'ensemble (remplace la simulation unique)
+    std::string ensembleOutputPath = "ensemble.bin";  // Séries temporelles de tous les runs, en colonnes
+
+    // 🧩 Découpage en tuiles : un processus par tuile (sans fenêtre)
+    int tileColumns = 0;            // 0 = pas de découpage
+    int tileRows = 0;
+    int tileBufferMegabytes = 64;   // Boîte aux lettres de chaque rang en mémoire partagée
+    bool tileCheck = false;         // Compare l'empreinte finale à une exécution en un seul processus
+
+    // 🪟 Mode fenêtré
+    int targetFrameRate = 60;  // 0 = pas de limitation (vsync éventuelle uniquement)
+    size_t lodThreshold = DEFAULT_LOD_THRESHOLD;  // Entités visibles au-delà desquelles la carte de densité remplace les corps (0 = jamais)
+
+    bool showHelp = false;
+};
+
+// 🧾 ANALYSE DE LA LIGNE DE COMMANDE : false (et message sur std::cerr) si invalide
+bool ParseCommandLine(int argc, char* argv[], SimulationConfig& config);
+void PrintUsage(const std::string& programName);
+
+} // namespace Core
+} // namespace Ecosystem
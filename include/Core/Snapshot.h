@@ -0,0 +1,139 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏷 SECTIONS D'UN INSTANTANÉ (valeurs figées : elles sont écrites dans le fichier)
+enum class SnapshotSection : uint32_t {
+    WORLD = 1,               // Paramètres du monde, horloge, statistiques
+    FOOD = 2,
+    WORLD_RANDOM = 3,        // Position du flux des tirages du monde entre deux ticks
+    FOOD_FIELD_SHAPE = 4,    // Dimensions et paramètres du champ de nourriture (absent sans champ)
+    FOOD_FIELD = 5,          // Énergie de chaque cellule du champ, bordure comprise
+    ENTITY_POSITION = 16,
+    ENTITY_PREVIOUS_POSITION = 17,
+    ENTITY_VELOCITY = 18,
+    ENTITY_ENERGY = 19,
+    ENTITY_MAX_ENERGY = 20,
+    ENTITY_AGE = 21,
+    ENTITY_MAX_AGE = 22,
+    ENTITY_TYPE = 23,
+    ENTITY_ALIVE = 24,
+    ENTITY_COLOR = 25,
+    ENTITY_SIZE = 26,
+    ENTITY_NAME_INDEX = 27,
+    ENTITY_LINEAGE = 28,
+    ENTITY_ID = 29,
+    ENTITY_SLOT = 30,
+    ENTITY_AGE_MARK = 31,    // Horloge d'âge au dernier contact (plantes en forme close)
+    ENTITY_GROWTH_MARK = 32, // Horloge de croissance au dernier contact
+    STORE_STATE = 48,        // Prochain identifiant
+    STORE_SLOTS = 49,        // Table des poignées
+    STORE_FREE_SLOTS = 50,
+    STORE_NAME_TEXT = 51,    // Noms internés, concaténés
+    STORE_NAME_ENDS = 52,    // Fin de chaque nom dans STORE_NAME_TEXT
+    STORE_PLANT_CLOCKS = 53, // Horloges des plantes (absent des instantanés plus anciens)
+    STORE_PARAMETERS = 54    // Métabolismes et chance de reproduction (absent : valeurs par défaut)
+};
+
+// 💾 FORMAT D'INSTANTANÉ BINAIRE (version 1, ordre des octets de la machine)
+// En-tête de 64 octets, table des sections, puis une colonne brute par
+// section, alignée sur 64 octets. Chaque colonne s'écrit et se relit d'un
+// seul bloc : aucune conversion ni travail par entité.
+const uint32_t SNAPSHOT_VERSION = 1;
+
+// ✍️ ÉCRITURE : les sections référencent la mémoire de l'appelant jusqu'à Write()
+class SnapshotWriter {
+private:
+    struct Section {
+        SnapshotSection tag;
+        uint32_t elementSize;
+        uint64_t count;
+        const void* data;
+        size_t ownedIndex;  // SIZE_MAX si la mémoire appartient à l'appelant
+    };
+    std::vector<Section> mSections;
+    std::vector<std::vector<unsigned char>> mOwned;  // Copies des petites sections temporaires
+
+public:
+    template <typename T>
+    void Add(SnapshotSection tag, const std::vector<T>& column) {
+        static_assert(std::is_trivially_copyable<T>::value, "colonne non copiable octet par octet");
+        mSections.push_back({tag, sizeof(T), column.size(), column.data(), SIZE_MAX});
+    }
+    // Copie immédiate : pour les valeurs calculées qui ne vivent pas jusqu'à Write()
+    template <typename T>
+    void AddCopy(SnapshotSection tag, const T* data, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "section non copiable octet par octet");
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+        mOwned.emplace_back(bytes, bytes + count * sizeof(T));
+        mSections.push_back({tag, sizeof(T), count, nullptr, mOwned.size() - 1});
+    }
+
+    // Écrit dans un fichier temporaire puis le renomme : un instantané n'est
+    // jamais à moitié écrit. false (et ❌) en cas d'échec.
+    bool Write(const std::string& path, uint64_t checksum) const;
+};
+
+// 📖 LECTURE : le fichier est projeté en mémoire (mmap) et les colonnes sont
+// recopiées d'un bloc depuis les pages projetées
+class SnapshotReader {
+private:
+    struct SectionEntry {
+        uint32_t tag;
+        uint32_t elementSize;
+        uint64_t count;
+        uint64_t offset;
+    };
+    const unsigned char* mData;
+    size_t mSize;
+    void* mMapping;                        // Non nul si le fichier est projeté
+    std::vector<unsigned char> mFallback;  // Plateformes sans mmap
+    const SectionEntry* mSections;
+    uint32_t mSectionCount;
+    uint64_t mChecksum;
+
+public:
+    SnapshotReader();
+    ~SnapshotReader();
+    SnapshotReader(const SnapshotReader&) = delete;
+    SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+    // false (et ❌) si le fichier est absent, tronqué ou d'une autre version
+    bool Open(const std::string& path);
+    uint64_t GetChecksum() const { return mChecksum; }
+    bool Has(SnapshotSection tag) const;  // Pour les sections facultatives
+
+    template <typename T>
+    bool Read(SnapshotSection tag, std::vector<T>& out) const {
+        static_assert(std::is_trivially_copyable<T>::value, "colonne non copiable octet par octet");
+        size_t count = 0;
+        const void* data = Find(tag, sizeof(T), count);
+        if (!data) return false;
+        const T* first = static_cast<const T*>(data);
+        out.assign(first, first + count);
+        return true;
+    }
+    template <typename T>
+    bool ReadValue(SnapshotSection tag, T& out) const {
+        static_assert(std::is_trivially_copyable<T>::value, "section non copiable octet par octet");
+        size_t count = 0;
+        const void* data = Find(tag, sizeof(T), count);
+        if (!data || count != 1) return false;
+        out = *static_cast<const T*>(data);
+        return true;
+    }
+
+private:
+    // nullptr (et ❌) si la section manque ou si la taille des éléments diffère
+    const void* Find(SnapshotSection tag, size_t elementSize, size_t& count) const;
+    void Close();
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,230 @@
+#pragma once
+#include "Structs.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🗺 GRILLE SPATIALE UNIFORME
+// Liste de cellules reconstruite à chaque tick par tri par comptage (O(n)).
+// Les éléments d'une même cellule sont contigus en mémoire, avec une copie
+// de leur position, ce qui évite de revenir aux entités pendant les requêtes.
+// Les positions hors du monde sont ramenées dans les cellules du bord : les
+// requêtes restent exactes puisque la distance réelle est toujours vérifiée.
+// Quand les éléments sont bien moins nombreux que les cellules (monde vaste et
+// clairsemé), seules les cellules occupées sont gardées, triées : la
+// reconstruction coûte O(n log n) au lieu de O(cellules), pour les mêmes résultats.
+const size_t SPARSE_GRID_CELLS_PER_ITEM = 64;  // Au-delà, la grille passe en mode clairsemé
+
+class SpatialGrid {
+private:
+    float mWorldWidth;
+    float mWorldHeight;
+    float mCellSize;
+    float mInvCellSize;
+    int mColumns;
+    int mRows;
+
+    // 📦 STOCKAGE "CSR" : mCellStart[c]..mCellStart[c+1] indexe mItems
+    std::vector<uint32_t> mCellStart;
+    std::vector<uint32_t> mItems;
+    std::vector<Vector2D> mItemPositions;
+    std::vector<uint32_t> mItemCells;  // Tampons réutilisés entre les reconstructions
+    std::vector<uint32_t> mCursor;
+
+    // 🌌 MODE CLAIRSEMÉ : mSparseCells (triées) et leurs débuts dans mItems
+    bool mSparse;
+    std::vector<uint32_t> mSparseCells;
+    std::vector<uint32_t> mSparseStart;
+    std::vector<uint64_t> mSparseKeys;  // (cellule << 32) | indice, triées
+
+public:
+    // 🏗 CONSTRUCTEUR
+    SpatialGrid(float worldWidth = 1.0f, float worldHeight = 1.0f, float cellSize = 150.0f);
+
+    // ⚙️ CONFIGURATION
+    void Configure(float worldWidth, float worldHeight, float cellSize);
+    void Clear();
+
+    // 🔄 RECONSTRUCTION : positionOf(i) doit renvoyer la position de l'élément i,
+    // accept(i) permet d'exclure certains éléments (morts, mauvaise espèce...)
+    template <typename PositionFn, typename AcceptFn>
+    void Build(size_t count, PositionFn positionOf, AcceptFn accept);
+
+    template <typename PositionFn>
+    void Build(size_t count, PositionFn positionOf) {
+        Build(count, positionOf, [](size_t) { return true; });
+    }
+    // Candidats limités à une liste d'indices croissants (les autres ne sont jamais acceptés) :
+    // même grille que Build(count, ...) pour un coût proportionnel à la liste
+    template <typename PositionFn, typename AcceptFn>
+    void Build(const std::vector<uint32_t>& indices, PositionFn positionOf, AcceptFn accept) {
+        BuildItems(indices.size(), [&indices](size_t k) { return static_cast<size_t>(indices[k]); }, positionOf, accept);
+    }
+
+    // 🔍 REQUÊTES
+    // visit(index, distanceAuCarre) pour chaque élément à moins de radius de center
+    template <typename Visitor>
+    void ForEachInRadius(Vector2D center, float radius, Visitor&& visit) const;
+
+    // Plus proche élément accepté dans le rayon, -1 si aucun
+    template <typename AcceptFn>
+    int FindNearest(Vector2D center, float radius, AcceptFn&& accept) const;
+    int FindNearest(Vector2D center, float radius) const {
+        return FindNearest(center, radius, [](uint32_t) { return true; });
+    }
+
+    void QueryRadius(Vector2D center, float radius, std::vector<uint32_t>& out) const;
+
+    // 📊 GETTERS
+    size_t GetItemCount() const { return mItems.size(); }
+    int GetCellCount() const { return mColumns * mRows; }
+    float GetCellSize() const { return mCellSize; }
+
+private:
+    // Élément k de la reconstruction : indexOf(k) croissant avec k
+    template <typename IndexFn, typename PositionFn, typename AcceptFn>
+    void BuildItems(size_t count, IndexFn indexOf, PositionFn positionOf, AcceptFn accept);
+    // Conversion bornée en flottant avant le cast (positions hors monde ou NaN)
+    static int ClampToCell(float scaled, int count) {
+        if (!(scaled > 0.0f)) return 0;
+        if (scaled >= static_cast<float>(count)) return count - 1;
+        return static_cast<int>(scaled);
+    }
+    int ColumnOf(float x) const { return ClampToCell(x * mInvCellSize, mColumns); }
+    int RowOf(float y) const { return ClampToCell(y * mInvCellSize, mRows); }
+    // Emplacements [begin, end) de la cellule dans mItems
+    void CellSlots(uint32_t cell, uint32_t& begin, uint32_t& end) const {
+        if (!mSparse) {
+            begin = mCellStart[cell];
+            end = mCellStart[cell + 1];
+            return;
+        }
+        auto found = std::lower_bound(mSparseCells.begin(), mSparseCells.end(), cell);
+        if (found == mSparseCells.end() || *found != cell) {
+            begin = end = 0;
+            return;
+        }
+        const size_t k = static_cast<size_t>(found - mSparseCells.begin());
+        begin = mSparseStart[k];
+        end = mSparseStart[k + 1];
+    }
+};
+
+// ---- IMPLÉMENTATIONS TEMPLATE ----
+
+template <typename PositionFn, typename AcceptFn>
+void SpatialGrid::Build(size_t count, PositionFn positionOf, AcceptFn accept) {
+    BuildItems(count, [](size_t i) { return i; }, positionOf, accept);
+}
+
+template <typename IndexFn, typename PositionFn, typename AcceptFn>
+void SpatialGrid::BuildItems(size_t count, IndexFn indexOf, PositionFn positionOf, AcceptFn accept) {
+    const size_t cellCount = static_cast<size_t>(mColumns) * static_cast<size_t>(mRows);
+    mItemCells.resize(count);
+
+    // 1. Cellule de chaque élément accepté
+    size_t accepted = 0;
+    for (size_t k = 0; k < count; ++k) {
+        const size_t i = indexOf(k);
+        if (!accept(i)) {
+            mItemCells[k] = UINT32_MAX;
+            continue;
+        }
+        Vector2D pos = positionOf(i);
+        mItemCells[k] = static_cast<uint32_t>(RowOf(pos.y) * mColumns + ColumnOf(pos.x));
+        accepted++;
+    }
+    mItems.resize(accepted);
+    mItemPositions.resize(accepted);
+
+    mSparse = accepted * SPARSE_GRID_CELLS_PER_ITEM < cellCount;
+    if (mSparse) {
+        // 2'. Monde clairsemé : tri par (cellule, indice), même ordre que la dispersion stable
+        mSparseKeys.clear();
+        for (size_t k = 0; k < count; ++k) {
+            if (mItemCells[k] != UINT32_MAX) mSparseKeys.push_back((static_cast<uint64_t>(mItemCells[k]) << 32) | indexOf(k));
+        }
+        std::sort(mSparseKeys.begin(), mSparseKeys.end());
+        mSparseCells.clear();
+        mSparseStart.clear();
+        for (size_t slot = 0; slot < accepted; ++slot) {
+            const uint32_t cell = static_cast<uint32_t>(mSparseKeys[slot] >> 32);
+            const uint32_t index = static_cast<uint32_t>(mSparseKeys[slot]);
+            if (mSparseCells.empty() || mSparseCells.back() != cell) {
+                mSparseCells.push_back(cell);
+                mSparseStart.push_back(static_cast<uint32_t>(slot));
+            }
+            mItems[slot] = index;
+            mItemPositions[slot] = positionOf(index);
+        }
+        mSparseStart.push_back(static_cast<uint32_t>(accepted));
+        return;
+    }
+
+    // 2. Comptage par cellule puis somme préfixe -> début de chaque cellule
+    mCellStart.assign(cellCount + 1, 0);
+    for (size_t k = 0; k < count; ++k) {
+        if (mItemCells[k] != UINT32_MAX) mCellStart[mItemCells[k] + 1]++;
+    }
+    for (size_t c = 0; c < cellCount; ++c) {
+        mCellStart[c + 1] += mCellStart[c];
+    }
+
+    // 3. Dispersion (stable : l'ordre des indices est conservé dans chaque cellule)
+    mCursor.assign(mCellStart.begin(), mCellStart.end() - 1);
+    for (size_t k = 0; k < count; ++k) {
+        uint32_t cell = mItemCells[k];
+        if (cell == UINT32_MAX) continue;
+        const size_t i = indexOf(k);
+        uint32_t slot = mCursor[cell]++;
+        mItems[slot] = static_cast<uint32_t>(i);
+        mItemPositions[slot] = positionOf(i);
+    }
+}
+
+template <typename Visitor>
+void SpatialGrid::ForEachInRadius(Vector2D center, float radius, Visitor&& visit) const {
+    if (mItems.empty()) return;
+
+    const float radiusSq = radius * radius;
+    const int minColumn = ColumnOf(center.x - radius);
+    const int maxColumn = ColumnOf(center.x + radius);
+    const int minRow = RowOf(center.y - radius);
+    const int maxRow = RowOf(center.y + radius);
+
+    for (int row = minRow; row <= maxRow; ++row) {
+        for (int column = minColumn; column <= maxColumn; ++column) {
+            uint32_t begin, end;
+            CellSlots(static_cast<uint32_t>(row * mColumns + column), begin, end);
+            for (uint32_t slot = begin; slot < end; ++slot) {
+                float dx = mItemPositions[slot].x - center.x;
+                float dy = mItemPositions[slot].y - center.y;
+                float distSq = dx * dx + dy * dy;
+                if (distSq < radiusSq) {
+                    visit(mItems[slot], distSq);
+                }
+            }
+        }
+    }
+}
+
+template <typename AcceptFn>
+int SpatialGrid::FindNearest(Vector2D center, float radius, AcceptFn&& accept) const {
+    int nearest = -1;
+    float nearestDistSq = radius * radius;
+    ForEachInRadius(center, radius, [&](uint32_t index, float distSq) {
+        // A distance égale, l'indice le plus petit gagne : résultat indépendant de l'ordre des cellules
+        if ((distSq < nearestDistSq || (distSq == nearestDistSq && static_cast<int>(index) < nearest))
+            && accept(index)) {
+            nearestDistSq = distSq;
+            nearest = static_cast<int>(index);
+        }
+    });
+    return nearest;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,99 @@
+#pragma once
+#include "Structs.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Ecosystem {
+namespace Core {
+
+// ÉNUMÉRATION DES TYPES D'ENTITÉS (indice dans SPECIES_TRAITS)
+enum class EntityType : uint8_t {
+    HERBIVORE,
+    CARNIVORE,
+    PLANT
+};
+
+// 📏 VITESSE ET RAYONS DE PERCEPTION PAR DÉFAUT
+constexpr float MAX_SPEED = 1.5f;       // Vitesse maximale après application des forces
+constexpr float SEEK_RADIUS = 150.0f;   // Rayon dans lequel l'entité cherche sa nourriture
+constexpr float AVOID_RADIUS = 120.0f;  // Rayon dans lequel un herbivore fuit les prédateurs
+
+// 🍽 RÉGIME : ce qui nourrit l'espèce
+enum class Diet : uint8_t {
+    SUNLIGHT,  // Photosynthèse (horloges du stockage)
+    FOOD,      // Sources de nourriture ou champ dense
+    PREY       // Autres entités
+};
+
+// 🧬 TRAITS D'UNE ESPÈCE
+struct SpeciesTraits {
+    const char* namePrefix;  // Nom généré "<préfixe><id>"
+    float initialEnergy;
+    float maxEnergy;
+    int maxAge;
+    float metabolism;   // Énergie dépensée par seconde (négative : produite)
+    float size;
+    Color color;
+    float moveSpeed;    // Distance par seconde à vitesse unité (0 : immobile)
+    float moveCost;     // Énergie dépensée par unité de vitesse et par seconde
+    float maxSpeed;     // Norme maximale de la vitesse après les forces de direction
+    float seekRadius;   // Rayon de recherche de nourriture (0 : ne cherche pas)
+    float avoidRadius;  // Rayon de fuite des prédateurs (0 : ne fuit pas)
+    Diet diet;
+    bool predator;      // Indexé dans la grille des prédateurs
+    bool prey;          // Chassé : indexé dans la grille des proies, mangé au contact d'un prédateur
+    bool clocked;       // Énergie et âge en forme close (horloges du stockage), hors des boucles du tick
+};
+
+// 📋 TABLE DES ESPÈCES, dans l'ordre d'EntityType : ajouter une espèce, c'est ajouter une ligne
+constexpr size_t SPECIES_COUNT = 3;
+constexpr SpeciesTraits SPECIES_TRAITS[SPECIES_COUNT] = {
+    // Préfixe      énergie   max   âge  métab. taille  couleur          vit.   coût  v.max      recherche    fuite         régime       préd.  proie  horloge
+    {"Herbivore_",  80.0f,  150.0f, 200,  1.5f,  8.0f, Color(0, 0, 255), 20.0f, 0.1f, MAX_SPEED, SEEK_RADIUS, AVOID_RADIUS, Diet::FOOD,     false, true,  false},
+    {"Carnivore_", 100.0f,  200.0f, 150,  2.0f, 12.0f, Color(255, 0, 0), 20.0f, 0.1f, MAX_SPEED, 0.0f,        0.0f,         Diet::PREY,     true,  false, false},
+    {"Plant_",      50.0f,  100.0f, 300, -0.5f,  6.0f, Color(0, 255, 0),  0.0f, 0.0f, 0.0f,      0.0f,        0.0f,         Diet::SUNLIGHT, false, false, true},
+};
+
+constexpr const SpeciesTraits& TraitsOf(EntityType type) {
+    return SPECIES_TRAITS[static_cast<size_t>(type)];
+}
+
+// Plus grand rayon de perception de la table : côté des cellules des grilles spatiales
+constexpr float MaxPerceptionRadius() {
+    float radius = 0.0f;
+    for (const SpeciesTraits& traits : SPECIES_TRAITS) {
+        radius = traits.seekRadius > radius ? traits.seekRadius : radius;
+        radius = traits.avoidRadius > radius ? traits.avoidRadius : radius;
+    }
+    return radius;
+}
+
+// Plus grande taille de la table : deux corps se touchent à moins de (taille + taille) / 2,
+// donc à moins de cette distance quelles que soient leurs espèces
+constexpr float MaxBodySize() {
+    float size = 0.0f;
+    for (const SpeciesTraits& traits : SPECIES_TRAITS) size = traits.size > size ? traits.size : size;
+    return size;
+}
+
+// 🧩 ESPÈCE CONNUE À LA COMPILATION : paramètre des noyaux spécialisés
+template <EntityType TYPE>
+struct Species {
+    static constexpr EntityType type = TYPE;
+    static constexpr size_t index = static_cast<size_t>(TYPE);
+    static constexpr const SpeciesTraits& traits = SPECIES_TRAITS[index];
+};
+
+// Appelle function(Species<T>()) pour chaque espèce de la table, dans l'ordre
+template <typename Function, size_t... INDICES>
+void ForEachSpecies(Function&& function, std::index_sequence<INDICES...>) {
+    (function(Species<static_cast<EntityType>(INDICES)>()), ...);
+}
+template <typename Function>
+void ForEachSpecies(Function&& function) {
+    ForEachSpecies(function, std::make_index_sequence<SPECIES_COUNT>());
+}
+
+} // namespace Core
+} // namespace Ecosystem
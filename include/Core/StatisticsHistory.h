@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 📈 ÉCHANTILLON D'UN TICK
+struct StatisticsSample {
+    uint32_t tick;
+    int32_t herbivores;
+    int32_t carnivores;
+    int32_t plants;
+    int32_t births;     // Pendant ce tick
+    int32_t deaths;     // Pendant ce tick
+    int32_t food;
+    float meanEnergy;   // Entités vivantes, après le métabolisme du tick
+};
+
+// 📈 SÉRIE TEMPORELLE À CAPACITÉ FIXE
+// Anneau d'échantillons alloué une fois : le plus ancien est écrasé quand il
+// est plein. Les lectures (tracé, export) ne touchent jamais aux entités.
+class StatisticsHistory {
+private:
+    std::vector<StatisticsSample> mSamples;
+    size_t mHead;  // Prochain emplacement écrit
+    size_t mSize;
+
+public:
+    explicit StatisticsHistory(size_t capacity = 3600);
+
+    void Push(const StatisticsSample& sample);
+    void Clear();
+
+    size_t Size() const { return mSize; }
+    size_t Capacity() const { return mSamples.size(); }
+    bool Empty() const { return mSize == 0; }
+    // 0 = plus ancien échantillon conservé, Size() - 1 = plus récent
+    const StatisticsSample& operator[](size_t index) const {
+        return mSamples[(mHead + mSamples.size() - mSize + index) % mSamples.size()];
+    }
+    const StatisticsSample& Latest() const { return (*this)[mSize - 1]; }
+
+    // 📊 Une colonne des count derniers échantillons, du plus ancien au plus récent (pour le tracé)
+    template <typename T>
+    void CopyColumn(T StatisticsSample::*field, std::vector<T>& out, size_t count = SIZE_MAX) const {
+        const size_t first = count < mSize ? mSize - count : 0;
+        out.clear();
+        out.reserve(mSize - first);
+        for (size_t i = first; i < mSize; ++i) out.push_back((*this)[i].*field);
+    }
+    // ➕ Somme d'une colonne sur les count derniers échantillons (naissances des N derniers ticks…)
+    template <typename T>
+    double Sum(T StatisticsSample::*field, size_t count) const {
+        double total = 0.0;
+        for (size_t i = count < mSize ? mSize - count : 0; i < mSize; ++i) total += (*this)[i].*field;
+        return total;
+    }
+
+    // 💾 Export CSV, une ligne par tick ; false (et ❌) si le fichier ne peut être écrit
+    bool WriteCsv(const std::string& path) const;
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,134 @@
+#pragma once
+#include "Entity.h"
+#include "Simd.h"
+#include "Structs.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+const float BOUNDS_MARGIN = 40.0f;  // Distance aux bords où la correction de trajectoire commence
+
+// 🧭 RÉFÉRENCE SCALAIRE DU STEERING
+// Formules utilisées par les méthodes d'Entity et, voie par voie, par les noyaux
+// vectoriels : mêmes opérations dans le même ordre, sans racine approchée.
+namespace Steering {
+
+// Direction normalisée vers la cible, multipliée par la force maximale
+inline Vector2D SeekTowards(const Vector2D& from, const Vector2D& target) {
+    float dx = target.x - from.x;
+    float dy = target.y - from.y;
+    float len = std::sqrt(dx * dx + dy * dy);
+    if (len <= 1e-6f) {
+        return Vector2D(0.0f, 0.0f);
+    }
+    return Vector2D((dx / len) * MAX_STEERING_FORCE, (dy / len) * MAX_STEERING_FORCE);
+}
+
+// Accumule la fuite pondérée par l'inverse de la distance à un prédateur
+inline void AccumulateFlee(const Vector2D& self, const Vector2D& predator,
+                           Vector2D& steer, float& totalWeight, float avoidRadius = AVOID_RADIUS) {
+    float dx = self.x - predator.x;
+    float dy = self.y - predator.y;
+    float distSq = dx * dx + dy * dy;
+    if (distSq > 0.0f && distSq < avoidRadius * avoidRadius) {
+        // Plus le prédateur est proche, plus la force de fuite est grande.
+        float weight = 1.0f / std::sqrt(distSq); // inverse de la distance
+        steer.x += dx * weight;
+        steer.y += dy * weight;
+        totalWeight += weight;
+    }
+}
+
+// Moyenne pondérée puis normalisation à la force maximale de direction
+inline Vector2D FinishFlee(Vector2D steer, float totalWeight) {
+    if (totalWeight <= 0.0f) {
+        return Vector2D(0.0f, 0.0f); // Aucun prédateur menaçant à portée
+    }
+    steer.x /= totalWeight;
+    steer.y /= totalWeight;
+    float len = std::sqrt(steer.x * steer.x + steer.y * steer.y);
+    if (len <= 1e-6f) {
+        return Vector2D(0.0f, 0.0f);
+    }
+    return Vector2D((steer.x / len) * MAX_STEERING_FORCE, (steer.y / len) * MAX_STEERING_FORCE);
+}
+
+// Poussée qui ramène l'entité dans la zone sûre, à la force maximale de direction
+inline Vector2D StayInBounds(const Vector2D& position, float worldWidth, float worldHeight) {
+    Vector2D steer{0.0f, 0.0f};
+    if (position.x < BOUNDS_MARGIN) {
+        steer.x = (BOUNDS_MARGIN - position.x); // pousse vers la droite
+    } else if (position.x > worldWidth - BOUNDS_MARGIN) {
+        steer.x = (worldWidth - BOUNDS_MARGIN - position.x); // pousse vers la gauche (négatif)
+    }
+    if (position.y < BOUNDS_MARGIN) {
+        steer.y = (BOUNDS_MARGIN - position.y); // pousse vers le bas
+    } else if (position.y > worldHeight - BOUNDS_MARGIN) {
+        steer.y = (worldHeight - BOUNDS_MARGIN - position.y); // pousse vers le haut (négatif)
+    }
+    // Si aucune correction n'est nécessaire
+    if (std::abs(steer.x) < 1e-6f && std::abs(steer.y) < 1e-6f) {
+        return Vector2D(0.0f, 0.0f);
+    }
+    float len = std::sqrt(steer.x * steer.x + steer.y * steer.y);
+    if (len > 1e-6f) {
+        steer.x = (steer.x / len) * MAX_STEERING_FORCE;
+        steer.y = (steer.y / len) * MAX_STEERING_FORCE;
+    }
+    return steer;
+}
+
+// Vitesse après une force, limitée pour que les forces cumulées ne s'emballent pas
+inline Vector2D ApplyForce(Vector2D velocity, Vector2D force, float maxSpeed = MAX_SPEED) {
+    velocity = velocity + force;
+    float speedSq = velocity.x * velocity.x + velocity.y * velocity.y;
+    if (speedSq > maxSpeed * maxSpeed) {
+        velocity = velocity * (maxSpeed / std::sqrt(speedSq));
+    }
+    return velocity;
+}
+
+} // namespace Steering
+
+// 📦 LOT D'ENTITÉS EMPAQUETÉES
+// Une voie par entité d'une même espèce : positions, vitesses et cible en colonnes
+// contiguës ; la vitesse maximale et le rayon de fuite sont ceux de l'espèce.
+// Les prédateurs à fuir de la voie l sont predatorX/Y[fleeBegin[l] .. + fleeCount[l]],
+// dans l'ordre où la grille les visite (l'ordre des sommes est celui de la référence).
+struct SteeringBatch {
+    std::vector<uint32_t> index;      // Indice dans l'EntityStore
+    std::vector<float> x, y;
+    std::vector<float> vx, vy;        // Vitesses, remplacées par Steer()
+    std::vector<float> targetX, targetY;
+    std::vector<uint32_t> hasTarget;  // 1 si une nourriture est à portée
+    std::vector<uint32_t> fleeBegin, fleeCount;
+    std::vector<float> predatorX, predatorY;
+    float maxSpeed = MAX_SPEED;        // Traits de l'espèce du lot (conservés par Clear)
+    float avoidRadius = AVOID_RADIUS;
+
+    void Clear();
+    size_t Size() const { return index.size(); }
+    // Ajoute une voie ; les prédateurs sont ajoutés ensuite avec AddPredator
+    void Add(uint32_t entityIndex, Vector2D position, Vector2D velocity, const Vector2D* target);
+    void AddPredator(Vector2D position) {
+        predatorX.push_back(position.x);
+        predatorY.push_back(position.y);
+        fleeCount.back()++;
+    }
+};
+
+// 🧭 NOYAU : recherche + fuite + limites, puis ApplyForce, pour toutes les voies.
+// Avec les options de compilation par défaut (sans contraction en FMA), les
+// résultats sont identiques au bit près à la référence scalaire quel que soit le
+// chemin ; si le compilateur fusionne multiplications et additions (-march=native,
+// -ffp-contract=fast avec FMA), l'écart reste sous 1e-5 en relatif par composante et par tick.
+void SteerBatch(SteeringBatch& batch, float worldWidth, float worldHeight);
+void SteerBatch(SteeringBatch& batch, float worldWidth, float worldHeight, SimdPath path);  // Chemin imposé (tests, bancs)
+
+} // namespace Core
+} // namespace Ecosystem
@@ -29,8 +29,8 @@ struct Color {
     uint8_t b; 
     uint8_t a; 
     // Constructeurs multiples 
-    Color() : r(255), g(255), b(255), a(255) {}  // Blanc par défaut 
-    Color(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha = 255)  
+    constexpr Color() : r(255), g(255), b(255), a(255) {}  // Blanc par défaut 
+    constexpr Color(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha = 255)  
         : r(red), g(green), b(blue), a(alpha) {} 
     // Couleurs prédéfinies 
     static Color Red() { return Color(255, 0, 0); } 
@@ -45,13 +45,6 @@ struct Food {
     // Constructeur 
     Food(Vector2D pos, float energy = 25.0f)  
         : position(pos), energyValue(energy), color(Color::Green()) {} 
-
-    struct random {
-        static float Float(float min, float max) {
-            return min + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / (max - min)));
-        }
-    };
-
 }; 
 } // namespace Core 
 } // namespace Ecosystem
\ No newline at end of file
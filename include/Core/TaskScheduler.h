@@ -0,0 +1,71 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🧵 ORDONNANCEUR DE TÂCHES À VOL DE TRAVAIL
+// ParallelFor découpe [0, count) en tranches de grainSize éléments réparties
+// dans une file par thread. Chaque thread dépile ses propres tranches par la
+// fin et, une fois à court, en vole au début de la file des autres. Le thread
+// appelant participe comme travailleur 0, donc un ordonnanceur à 1 thread
+// exécute tout en série sans aucune synchronisation.
+// Le découpage ne dépend que de count et grainSize : le résultat d'un corps
+// qui n'écrit que dans ses propres éléments est identique quel que soit le
+// nombre de threads.
+class TaskScheduler {
+public:
+    // body(begin, end, worker) ; worker < GetThreadCount() indexe les tampons par thread
+    using RangeTask = std::function<void(size_t begin, size_t end, unsigned worker)>;
+
+private:
+    struct Chunk {
+        size_t begin;
+        size_t end;
+    };
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Chunk> chunks;
+    };
+
+    unsigned mThreadCount;
+    std::vector<std::thread> mThreads;
+    std::vector<std::unique_ptr<WorkerQueue>> mQueues;
+
+    std::atomic<const RangeTask*> mCurrentTask;
+    std::atomic<size_t> mPendingChunks;
+
+    std::mutex mWakeMutex;
+    std::condition_variable mWakeCondition;
+    std::condition_variable mDoneCondition;
+    unsigned long long mGeneration;
+    bool mStopping;
+
+public:
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR (threadCount = 0 : un thread par cœur)
+    explicit TaskScheduler(unsigned threadCount = 1);
+    ~TaskScheduler();
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    // ⚙️ EXÉCUTION PARALLÈLE (bloquante jusqu'à la fin de toutes les tranches)
+    void ParallelFor(size_t count, size_t grainSize, const RangeTask& body);
+
+    // 📊 GETTERS
+    unsigned GetThreadCount() const { return mThreadCount; }
+
+private:
+    void WorkerLoop(unsigned worker);
+    bool RunOneChunk(unsigned worker);
+};
+
+} // namespace Core
+} // namespace Ecosystem
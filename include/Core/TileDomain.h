@@ -0,0 +1,119 @@
+#pragma once
+#include "Structs.h"
+#include "TileExchange.h"
+#include "SimulationConfig.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🧩 DÉCOUPAGE DU MONDE EN TUILES
+// Le rectangle du monde est coupé en columns x rows tuiles égales, une par
+// processus (rang = ligne * columns + colonne). Une entité appartient à la
+// tuile qui contient sa position ; les tuiles du bord s'étendent au-delà du
+// monde. Chaque rang tient, en plus de ses entités, des fantômes : copies
+// des entités voisines dont ses propres entités ont besoin pendant le tick
+// (prédateurs à fuir, proies à attraper), rangées par identifiant avec les
+// siennes, dormantes et jamais comptées. La nourriture et les tirages du
+// monde sont répliqués : chaque rang fait les mêmes, dans le même ordre.
+class TileDomain {
+private:
+    TileExchange& mExchange;
+    int mColumns;
+    int mRows;
+    float mTileWidth;
+    float mTileHeight;
+    std::vector<uint8_t> mGhosts;  // Aligné sur les lignes du stockage ; au-delà : lignes possédées
+    size_t mLiveCount;             // Entités vivantes de tout le monde (limite d'entités)
+    TileExchange::Messages mOutgoing;  // Tampons réutilisés d'un échange à l'autre
+    TileExchange::Messages mIncoming;
+
+    int ColumnOf(float x) const;
+    int RowOf(float y) const;
+
+public:
+    TileDomain(TileExchange& exchange, int columns, int rows, float worldWidth, float worldHeight);
+
+    // 📐 GÉOMÉTRIE
+    int GetRank() const { return mExchange.GetRank(); }
+    int GetRankCount() const { return mExchange.GetRankCount(); }
+    int OwnerOf(Vector2D position) const;
+    bool Owns(Vector2D position) const { return OwnerOf(position) == GetRank(); }
+    // Rangs dont la tuile, élargie de margin de chaque côté, contient position (ajoutés à out)
+    void RanksNear(Vector2D position, float margin, std::vector<int>& out) const;
+
+    // 👻 FANTÔMES
+    bool IsGhost(size_t index) const { return index < mGhosts.size() && mGhosts[index]; }
+    void SetGhosts(std::vector<uint8_t>& flags) { mGhosts.swap(flags); }
+    void ClearGhosts() { mGhosts.clear(); }
+
+    // 🔢 POPULATION GLOBALE (même valeur sur tous les rangs)
+    size_t GetLiveCount() const { return mLiveCount; }
+    void SetLiveCount(size_t count) { mLiveCount = count; }
+
+    // 🔁 COLLECTIFS TYPÉS (T copiable octet par octet) : même appel, dans le même ordre,
+    // sur tous les rangs. false si un rang a échoué : incoming est alors vide
+    template <typename T>
+    bool Exchange(const std::vector<std::vector<T>>& outgoing, std::vector<std::vector<T>>& incoming);
+    template <typename T>
+    bool AllGather(const std::vector<T>& mine, std::vector<std::vector<T>>& all);  // all[r] : envoi du rang r
+    bool HasFailed() const { return mExchange.HasFailed(); }
+};
+
+template <typename T>
+bool TileDomain::Exchange(const std::vector<std::vector<T>>& outgoing, std::vector<std::vector<T>>& incoming) {
+    const int ranks = GetRankCount();
+    mOutgoing.resize(ranks);
+    for (int rank = 0; rank < ranks; ++rank) {
+        const std::vector<T>& items = outgoing[rank];
+        mOutgoing[rank].resize(items.size() * sizeof(T));
+        if (!items.empty()) std::memcpy(mOutgoing[rank].data(), items.data(), mOutgoing[rank].size());
+    }
+    incoming.assign(ranks, std::vector<T>());
+    if (!mExchange.Exchange(mOutgoing, mIncoming)) return false;
+    for (int rank = 0; rank < ranks; ++rank) {
+        incoming[rank].resize(mIncoming[rank].size() / sizeof(T));
+        if (!incoming[rank].empty()) std::memcpy(incoming[rank].data(), mIncoming[rank].data(), mIncoming[rank].size());
+    }
+    return true;
+}
+
+template <typename T>
+bool TileDomain::AllGather(const std::vector<T>& mine, std::vector<std::vector<T>>& all) {
+    return Exchange(std::vector<std::vector<T>>(GetRankCount(), mine), all);
+}
+
+// 🏁 EXÉCUTION EN TUILES (sans fenêtre)
+// Un processus par tuile, lancé par TileExchange ; chaque rang fait avancer
+// son propre écosystème du même nombre de ticks. L'état final est réuni sur
+// le rang 0 : populations additionnées et empreinte calculée sur toutes les
+// entités rangées par identifiant, identique à celle d'une exécution en un
+// seul processus avec la même graine. Pas de trace, d'instantané ni de champ
+// de nourriture dense, et une durée en ticks obligatoire.
+class TileRunner {
+public:
+    struct Report {
+        long long ticks;
+        double elapsedSeconds;
+        int ranks;
+        int herbivores;
+        int carnivores;
+        int plants;
+        int food;
+        size_t entities;
+        size_t largestTile;  // Entités possédées par la tuile la plus peuplée
+        uint32_t seed;
+        uint64_t checksum;
+    };
+
+    // false (et ❌) si la configuration ne s'y prête pas ou si un rang a échoué
+    static bool Run(const SimulationConfig& config, Report& report);
+    // Même simulation en un seul processus : empreinte de référence de --tile-check
+    static uint64_t RunReference(const SimulationConfig& config, uint32_t seed);
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+// 📮 ÉCHANGES ENTRE PROCESSUS PAR MÉMOIRE PARTAGÉE
+// Une zone anonyme partagée est créée avant fork() : chaque rang y possède une
+// boîte aux lettres où il dépose, à chaque échange, un message par rang
+// destinataire (table de décalages puis octets). Une barrière en mémoire
+// partagée sépare le dépôt de la lecture, une seconde libère les boîtes pour
+// l'échange suivant. Un rang en échec (boîte trop petite, processus mort) le
+// signale dans la zone : tous les collectifs suivants renvoient false.
+// Disponible sur les systèmes POSIX seulement.
+class TileExchange {
+public:
+    using Messages = std::vector<std::vector<uint8_t>>;  // Un message par rang
+
+    // 🚀 Lance rankCount processus qui partagent la zone (rang 0 : le processus appelant,
+    // les autres par fork) et exécute body dans chacun. Les enfants se terminent sans
+    // revenir. false (et ❌) si la zone n'a pu être créée ou si un rang a échoué
+    static bool Launch(int rankCount, size_t mailboxBytes, const std::function<bool(TileExchange&)>& body);
+
+    int GetRank() const { return mRank; }
+    int GetRankCount() const { return mRankCount; }
+
+    // 🔁 Collectif : outgoing[r] part vers le rang r (y compris soi-même), incoming[r]
+    // vient du rang r. false si un rang a échoué
+    bool Exchange(const Messages& outgoing, Messages& incoming);
+    bool Barrier();
+    void Fail();  // Signale l'échec à tous les rangs
+    bool HasFailed() const;
+
+private:
+    struct Shared;
+    Shared* mShared;
+    uint8_t* mMailboxes;
+    size_t mMailboxBytes;
+    int mRank;
+    int mRankCount;
+    std::vector<int> mChildren;  // Rang 0 : processus enfants encore surveillés
+    bool mChildFailed;
+
+    TileExchange(void* region, size_t mailboxBytes, int rank, int rankCount);
+    uint8_t* MailboxOf(int rank) const { return mMailboxes + static_cast<size_t>(rank) * mMailboxBytes; }
+    void PollChildren(uint32_t generation);  // Rang 0 : un enfant terminé avant la fin fait échouer la barrière
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,114 @@
+#pragma once
+#include "EntityStore.h"
+#include "Structs.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace Ecosystem {
+namespace Core {
+
+const float REGION_SIZE = 256.0f;           // Côté d'une région en unités du monde
+const uint32_t SLEEP_CHECK_INTERVAL = 16;   // Ticks entre deux tentatives de mise en sommeil
+
+// 💤 RÉGIONS DU MONDE ET MISE EN SOMMEIL
+// Le monde est découpé en régions carrées. Une région est calme quand aucun
+// animal n'occupe ni elle ni ses huit voisines. Dans une région calme, chaque
+// plante qui n'a rien à faire d'ici sa prochaine échéance s'endort, immature
+// ou mûre : énergie positive, pas fertile, et loin du seuil de fertilité comme
+// du plafond d'énergie. Son état reste en forme close (voir EntityStore) ; elle
+// sort de tout parcours du tick (store.asleep) et la région tient son énergie
+// agrégée pour la moyenne (en double, sans l'arrondi float de chaque plante : la
+// moyenne peut différer au dernier chiffre affiché). La région se réveille en entier dès qu'un animal
+// entre dans son voisinage, quand l'horloge d'âge atteint la mort de vieillesse
+// d'un membre (ou la maturité d'une plante déjà assez chargée pour se
+// reproduire), ou quand l'horloge de croissance approche le seuil de fertilité
+// ou le plafond d'énergie de l'un d'eux : l'état simulé est identique, au bit
+// près, à une simulation sans sommeil. Les animaux ne dorment jamais : chaque
+// tick les déplace, et ce sont eux qui tiennent leur voisinage éveillé.
+class WorldRegions {
+public:
+    // Énergie d'entités endormies à l'horloge de croissance G : capped + open + openCount x G
+    struct SleepingEnergy {
+        double capped = 0.0;   // Plantes au plafond : énergie fixe
+        double open = 0.0;     // Autres plantes : énergie au dernier contact moins sa date
+        uint32_t openCount = 0;
+        uint32_t count = 0;
+        double At(double growthClock) const { return capped + open + openCount * growthClock; }
+    };
+
+private:
+    struct Region {
+        uint8_t asleep = 0;
+        uint8_t touched = 0;                // Dans mTouched pendant TrySleep
+        uint32_t sleepingSlot = 0;          // Position dans mSleeping
+        uint32_t serial = 0;                // Avance à chaque réveil : échéances précédentes périmées
+        int64_t ageDeadline = 0;            // Horloge d'âge à laquelle il faudra se réveiller
+        double growthDeadline = 0.0;        // Horloge de croissance à laquelle il faudra se réveiller
+        SleepingEnergy energy;
+        std::vector<EntityHandle> members;  // Entités endormies (poignées : stables à la compaction)
+    };
+    template <typename Clock>
+    struct Due {
+        Clock due;
+        uint32_t region;
+        uint32_t serial;
+        bool operator>(const Due& other) const { return due > other.due; }
+    };
+    template <typename Clock>
+    using DueQueue = std::priority_queue<Due<Clock>, std::vector<Due<Clock>>, std::greater<Due<Clock>>>;
+
+    float mRegionSize;
+    float mInvRegionSize;
+    int mColumns;
+    int mRows;
+    bool mEnabled;
+    std::vector<Region> mRegions;
+    std::vector<uint8_t> mActive;       // Région ou voisine occupée par un animal ce tick
+    std::vector<uint32_t> mActiveList;  // Régions marquées dans mActive (remises à zéro au tick suivant)
+    std::vector<uint32_t> mSleeping;    // Régions endormies : aucun parcours de toutes les régions par tick
+    std::vector<uint32_t> mTouched;     // Régions qui ont pris des membres pendant TrySleep
+    DueQueue<int64_t> mAgeDue;          // Échéances des régions endormies, dépilées quand elles tombent
+    DueQueue<double> mGrowthDue;
+    SleepingEnergy mEnergy;             // Somme sur les régions endormies
+
+public:
+    // 🏗 CONSTRUCTEUR
+    WorldRegions();
+
+    // ⚙️ CONFIGURATION : toutes les régions éveillées (le stockage doit l'être aussi)
+    void Configure(float worldWidth, float worldHeight, float regionSize = REGION_SIZE);
+    void Reset();
+    // Désactivé : réveille toutes les entités de store
+    void SetEnabled(bool enabled, EntityStore& store, std::vector<size_t>& changed);
+    bool IsEnabled() const { return mEnabled; }
+
+    // 🔄 DÉBUT DE TICK, horloges des plantes déjà avancées. Chaque ligne dont
+    // store.asleep change est ajoutée à changed
+    // Réveil : voisinage des animaux de awakeRows (lignes éveillées), échéances atteintes
+    void Wake(EntityStore& store, const std::vector<uint32_t>& awakeRows, std::vector<size_t>& changed);
+    // Mise en sommeil des plantes éligibles de candidates (lignes non endormies) dans les régions calmes
+    void TrySleep(EntityStore& store, const std::vector<uint32_t>& candidates, std::vector<size_t>& changed);
+    void WakeAll(EntityStore& store, std::vector<size_t>& changed);
+    void WakeAt(Vector2D position, EntityStore& store, std::vector<size_t>& changed);  // Réveille la région de position
+
+    // 📊 GETTERS
+    size_t GetRegionCount() const { return mRegions.size(); }
+    size_t GetSleepingRegionCount() const { return mSleeping.size(); }
+    size_t GetSleepingEntityCount() const { return mEnergy.count; }
+    const SleepingEnergy& GetSleepingEnergy() const { return mEnergy; }
+    bool IsAsleep(Vector2D position) const { return mRegions[RegionOf(position)].asleep != 0; }
+    float GetRegionSize() const { return mRegionSize; }
+    int GetColumns() const { return mColumns; }
+    int GetRows() const { return mRows; }
+
+private:
+    size_t RegionOf(Vector2D position) const;
+    void MarkActivity(const EntityStore& store, const std::vector<uint32_t>& awakeRows);
+    void WakeRegion(size_t regionIndex, EntityStore& store, std::vector<size_t>& changed);
+};
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,35 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+#include "../Core/Structs.h"
+namespace Ecosystem {
+namespace Graphics {
+// 🧱 RENDU PAR LOTS
+// Les rectangles pleins de l'image sont accumulés dans un seul tampon de
+// sommets/indices puis envoyés en un appel SDL_RenderGeometry, au lieu d'un
+// SDL_SetRenderDrawColor + SDL_RenderFillRect par rectangle. L'ordre d'ajout
+// est l'ordre de dessin. Les tampons gardent leur capacité d'une image à
+// l'autre : en régime établi, le rendu n'alloue rien.
+class BatchRenderer {
+public:
+    // Rectangles par appel : les indices d'un appel tiennent sur 16 bits
+    static const size_t MAX_RECTS_PER_CALL = 16384;
+private:
+    std::vector<SDL_Vertex> mVertices;
+    std::vector<int> mIndices;  // Motif commun à toutes les tranches, jamais vidé
+    size_t mDrawCalls;  // Appels de la dernière image (statistique)
+public:
+    // 🏗 CONSTRUCTEUR
+    BatchRenderer();
+    // ⚙️ CONSTRUCTION DE L'IMAGE
+    void Begin();  // Vide le lot sans libérer la mémoire
+    void Reserve(size_t rectCount);
+    void AddRect(float x, float y, float width, float height, const Core::Color& color);
+    // Envoie le lot au renderer, par tranches de MAX_RECTS_PER_CALL rectangles
+    void Flush(SDL_Renderer* renderer);
+    // 📊 GETTERS
+    size_t GetRectCount() const { return mVertices.size() / 4; }
+    size_t GetDrawCalls() const { return mDrawCalls; }
+};
+} // namespace Graphics
+} // namespace Ecosystem
@@ -0,0 +1,30 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include "../Core/RenderFrame.h"
+namespace Ecosystem {
+namespace Graphics {
+// 🗺 TEXTURE DE LA CARTE DE DENSITÉ
+// Texture en flux d'un texel par cellule, tenue par le thread de rendu. Chaque
+// image publiée n'apporte que les tuiles de cellules modifiées : Apply() ne
+// transfère qu'elles, une seule fois par image. Dessinée étirée sur le monde
+// (filtrage linéaire), d'autant plus opaque que le détail de l'image est faible.
+class DensityTexture {
+private:
+    SDL_Texture* mTexture;
+    int mColumns;
+    int mRows;
+    uint64_t mSerial;  // Dernière image appliquée
+public:
+    // 🏗 CONSTRUCTEUR/DESTRUCTEUR
+    DensityTexture();
+    ~DensityTexture();
+    DensityTexture(const DensityTexture&) = delete;
+    DensityTexture& operator=(const DensityTexture&) = delete;
+    // ⚙️ Envoie les cellules modifiées de l'image (recrée la texture si la carte a changé de taille)
+    void Apply(SDL_Renderer* renderer, const Core::RenderFrame& frame);
+    void Draw(SDL_Renderer* renderer, const Core::RenderFrame& frame, const Core::RenderView& view) const;
+    void Release();
+};
+} // namespace Graphics
+} // namespace Ecosystem
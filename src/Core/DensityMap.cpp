@@ -0,0 +1,135 @@
+#include "Core/DensityMap.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Ecosystem {
+namespace Core {
+
+namespace {
+uint32_t Channel(uint32_t count) {
+    return std::min<uint32_t>(255, count * 255 / DENSITY_SATURATION);
+}
+} // namespace
+
+// 🏗 CONSTRUCTEUR
+DensityMap::DensityMap()
+    : mWorldWidth(0.0f), mWorldHeight(0.0f), mCellSize(DENSITY_MIN_CELL_SIZE),
+      mInvCellSize(1.0f / DENSITY_MIN_CELL_SIZE), mColumns(0), mRows(0), mTotal(0), mTileColumns(0), mTileRows(0) {}
+
+// ⚙️ CONFIGURATION
+void DensityMap::Configure(float worldWidth, float worldHeight) {
+    mWorldWidth = worldWidth;
+    mWorldHeight = worldHeight;
+    mCellSize = std::max(DENSITY_MIN_CELL_SIZE, worldWidth / DENSITY_MAX_COLUMNS);
+    mInvCellSize = 1.0f / mCellSize;
+    mColumns = std::max(1, static_cast<int>(std::ceil(worldWidth * mInvCellSize)));
+    mRows = std::max(1, static_cast<int>(std::ceil(worldHeight * mInvCellSize)));
+    const size_t cells = static_cast<size_t>(mColumns) * mRows;
+    mCounts.assign(cells * 3, 0);
+    mTotal = 0;
+    mChangedCells.clear();
+    mCellChanged.assign(cells, 0);
+    mPixels.assign(cells, 0);
+    mTileColumns = (mColumns + DENSITY_TILE_SIZE - 1) / DENSITY_TILE_SIZE;
+    mTileRows = (mRows + DENSITY_TILE_SIZE - 1) / DENSITY_TILE_SIZE;
+    mDirtyTiles.assign(static_cast<size_t>(mTileColumns) * mTileRows, 1);  // Texture neuve : tout est à envoyer
+}
+
+// 🔄 RECOMPTE COMPLET : chaque cellule est comparée à son ancien compte
+void DensityMap::Recount(const EntityStore& store) {
+    std::vector<uint32_t> previous(mCounts.size(), 0);
+    previous.swap(mCounts);
+    mTotal = 0;
+    for (size_t i = 0; i < store.Size(); ++i) {
+        if (store.IsTombstone(i)) continue;
+        mCounts[CellOf(store.position[i]) * 3 + static_cast<size_t>(store.type[i])]++;
+        ++mTotal;
+    }
+    for (size_t cell = 0; cell * 3 < mCounts.size(); ++cell) {
+        if (mCellChanged[cell] || std::equal(&mCounts[cell * 3], &mCounts[cell * 3] + 3, &previous[cell * 3])) continue;
+        mCellChanged[cell] = 1;
+        mChangedCells.push_back(static_cast<uint32_t>(cell));
+    }
+}
+
+// 👁 ENTITÉS DES CELLULES DANS LA VUE
+size_t DensityMap::CountVisible(const RenderView& view) const {
+    if (view.IsWhole()) return mTotal;
+    const int firstColumn = ColumnOf(view.x);
+    const int lastColumn = ColumnOf(view.x + view.width);
+    const int firstRow = RowOf(view.y);
+    const int lastRow = RowOf(view.y + view.height);
+    size_t visible = 0;
+    for (int row = firstRow; row <= lastRow; ++row) {
+        const uint32_t* counts = &mCounts[(static_cast<size_t>(row) * mColumns + firstColumn) * 3];
+        for (int column = firstColumn; column <= lastColumn; ++column, counts += 3) {
+            visible += counts[0] + counts[1] + counts[2];
+        }
+    }
+    return visible;
+}
+
+// 📤 TUILES MODIFIÉES VERS L'IMAGE PUBLIÉE
+void DensityMap::TakeDirty(DensityPatch& patch) {
+    // Seules les cellules dont un compte a bougé sont repeintes
+    for (uint32_t cell : mChangedCells) {
+        mCellChanged[cell] = 0;
+        const uint32_t* counts = &mCounts[static_cast<size_t>(cell) * 3];
+        const uint32_t blue = Channel(counts[static_cast<size_t>(EntityType::HERBIVORE)]);
+        const uint32_t red = Channel(counts[static_cast<size_t>(EntityType::CARNIVORE)]);
+        const uint32_t green = Channel(counts[static_cast<size_t>(EntityType::PLANT)]);
+        const uint32_t alpha = std::max({red, green, blue});
+        const uint32_t pixel = (red << 24) | (green << 16) | (blue << 8) | alpha;
+        if (pixel == mPixels[cell]) continue;
+        mPixels[cell] = pixel;
+        const int row = static_cast<int>(cell) / mColumns;
+        const int column = static_cast<int>(cell) % mColumns;
+        mDirtyTiles[static_cast<size_t>(row / DENSITY_TILE_SIZE) * mTileColumns + column / DENSITY_TILE_SIZE] = 1;
+    }
+    mChangedCells.clear();
+    patch.columns = mColumns;
+    patch.rows = mRows;
+    patch.cellSize = mCellSize;
+    patch.regions.clear();
+    patch.pixels.clear();
+    for (int tileRow = 0; tileRow < mTileRows; ++tileRow) {
+        const uint8_t* dirty = &mDirtyTiles[static_cast<size_t>(tileRow) * mTileColumns];
+        for (int tile = 0; tile < mTileColumns; ++tile) {
+            if (!dirty[tile]) continue;
+            // Suite de tuiles modifiées voisines : une seule région
+            int last = tile;
+            while (last + 1 < mTileColumns && dirty[last + 1]) ++last;
+            DensityPatch::Region region;
+            region.x = tile * DENSITY_TILE_SIZE;
+            region.y = tileRow * DENSITY_TILE_SIZE;
+            region.width = std::min((last + 1) * DENSITY_TILE_SIZE, mColumns) - region.x;
+            region.height = std::min(region.y + DENSITY_TILE_SIZE, mRows) - region.y;
+            region.offset = patch.pixels.size();
+            for (int row = region.y; row < region.y + region.height; ++row) {
+                const uint32_t* source = &mPixels[static_cast<size_t>(row) * mColumns + region.x];
+                patch.pixels.insert(patch.pixels.end(), source, source + region.width);
+            }
+            patch.regions.push_back(region);
+            tile = last;
+        }
+    }
+    std::fill(mDirtyTiles.begin(), mDirtyTiles.end(), 0);
+}
+
+// 🔢 CELLULES
+int DensityMap::ColumnOf(float x) const {
+    return static_cast<int>(std::fmin(std::fmax(x * mInvCellSize, 0.0f), static_cast<float>(mColumns - 1)));
+}
+int DensityMap::RowOf(float y) const {
+    return static_cast<int>(std::fmin(std::fmax(y * mInvCellSize, 0.0f), static_cast<float>(mRows - 1)));
+}
+void DensityMap::AddToCell(size_t cell, EntityType type, int delta) {
+    mCounts[cell * 3 + static_cast<size_t>(type)] += delta;
+    mTotal += delta;
+    if (mCellChanged[cell]) return;
+    mCellChanged[cell] = 1;
+    mChangedCells.push_back(static_cast<uint32_t>(cell));
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -1,6 +1,12 @@
 #include "Core/Ecosystem.h"
+#include "Core/Logger.h"
+#include "Core/Profiler.h"
+#include "Core/Snapshot.h"
+#include "Core/TileDomain.h"
 #include <algorithm> 
+#include <cmath> 
 #include <iostream> 
+#include <random> 
 #include <SDL3/SDL.h> // Ajout pour SDL_FRect, SDL_SetRenderDrawColor etc.
 #include <string> // Ajout pour std::to_string
 
@@ -8,24 +14,161 @@
 
 namespace Ecosystem { 
 namespace Core { 
+// Taille d'une tranche de travail parallèle (indépendante du nombre de threads) 
+const size_t ENTITY_CHUNK_SIZE = 1024; 
+// Compaction des colonnes dès que plus d'une ligne sur 8 est une tombe 
+const size_t TOMBSTONE_COMPACTION_DIVISOR = 8; 
+// 🧩 MARGES DES FANTÔMES 
+namespace { 
+// Prédateurs qu'une proie de la tuile peut fuir : jusqu'au plus grand rayon de fuite 
+constexpr float PredatorHaloBand() { 
+    float radius = 0.0f; 
+    for (const SpeciesTraits& traits : SPECIES_TRAITS) radius = traits.avoidRadius > radius ? traits.avoidRadius : radius; 
+    return radius; 
+} 
+// Proies qu'un prédateur de la tuile peut toucher : contact, plus un pas de chacun. Un pas 
+// reste sous 2 x vitesse x dt (vitesse bornée par maxSpeed, ou direction tirée de norme <= racine de 2) 
+float PreyHaloBand(float deltaTime) { 
+    float moveSpeed = 0.0f; 
+    for (const SpeciesTraits& traits : SPECIES_TRAITS) moveSpeed = std::max(moveSpeed, traits.moveSpeed); 
+    return MaxBodySize() + 2.0f * (2.0f * moveSpeed * deltaTime); 
+} 
+// Bords des séries relevés sans branchement : un indice est écrit à chaque changement d'état 
+template <typename StateFn> 
+void ScanRuns(size_t begin, size_t end, StateFn stateOf, std::vector<uint32_t>& runs) { 
+    runs.resize(end - begin + 2); 
+    size_t written = 0; 
+    uint8_t previous = 1;  // La tranche commence comme après une entité écartée 
+    for (size_t i = begin; i < end; ++i) { 
+        const uint8_t state = stateOf(i); 
+        runs[written] = static_cast<uint32_t>(i); 
+        written += state ^ previous; 
+        previous = state; 
+    }
+    runs[written] = static_cast<uint32_t>(end); 
+    written += previous ^ 1u; 
+    runs.resize(written); 
+}
+// Les grilles des animaux ne parcourent que les lignes éveillées : une espèce à horloge 
+// (dormante ou endormie) n'y a pas sa place 
+constexpr bool ClockedSpeciesOutsideGrids() { 
+    for (const SpeciesTraits& traits : SPECIES_TRAITS) { 
+        if (traits.clocked && (traits.prey || traits.predator)) return false; 
+    }
+    return true; 
+}
+static_assert(ClockedSpeciesOutsideGrids(), "Une espèce à horloge ne peut être ni proie ni prédateur"); 
+} // namespace 
+// 🧵 SÉRIES ÉVEILLÉES (toute la tranche tant qu'aucune série n'a été relevée) 
+template <typename RunFn> 
+void Ecosystem::ParallelForAwake(RunFn body) { 
+    ParallelForEntities([this, &body](size_t begin, size_t end, unsigned worker) { 
+        ForEachAwakeRun(begin, end, worker, body); 
+    }); 
+}
+// Séries éveillées d'une tranche, dans l'ordre des indices (les naissances du tick sont parcourues) 
+template <typename RunFn> 
+void Ecosystem::ForEachAwakeRun(size_t begin, size_t end, unsigned worker, RunFn&& body) const { 
+    ForEachRun(&ChunkRuns::awake, begin, end, worker, body); 
+}
+template <typename RunFn> 
+void Ecosystem::ForEachRun(std::vector<uint32_t> ChunkRuns::*runs, size_t begin, size_t end, unsigned worker, 
+                           RunFn&& body) const { 
+    if (mChunkRuns.empty()) { 
+        body(begin, end, worker); 
+        return; 
+    }
+    const size_t chunk = begin / ENTITY_CHUNK_SIZE; 
+    if (chunk < mChunkRuns.size()) { 
+        const std::vector<uint32_t>& pairs = mChunkRuns[chunk].*runs; 
+        for (size_t run = 0; run < pairs.size(); run += 2) body(pairs[run], pairs[run + 1], worker); 
+    }
+    if (end > mAwakeCounted) body(std::max(begin, mAwakeCounted), end, worker); 
+}
+// 🗺 GRILLE D'ANIMAUX : candidates limitées aux lignes éveillées quand leur liste est à jour 
+template <typename AcceptFn> 
+void Ecosystem::BuildAnimalGrid(SpatialGrid& grid, AcceptFn accept) { 
+    const auto positionOf = [this](size_t i) { return mEntities.position[i]; }; 
+    if (AwakeRowsCurrent()) { 
+        grid.Build(mAwakeRows, positionOf, accept); 
+    } else { 
+        grid.Build(mEntities.Size(), positionOf, accept); 
+    }
+}
 // 🏗 CONSTRUCTEUR 
 Ecosystem::Ecosystem(float width, float height, int maxEntities) 
-    : mWorldWidth(width), mWorldHeight(height), mMaxEntities(maxEntities), 
-      mDayCycle(0), mRandomGenerator(std::random_device{}()) 
+    : mAwakeCounted(0), mWorldWidth(width), mWorldHeight(height), mMaxEntities(maxEntities), 
+      mDayCycle(0), 
+      mSeed((static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}()), 
+      mWorldRandom(mSeed, WORLD_RANDOM_ENTITY, 0, RandomPurpose::WORLD), 
+      mScheduler(std::make_unique<TaskScheduler>(1)), mWorkerBuffers(1), mTrace(nullptr), mDomain(nullptr), 
+      mCaptureCount(0), mDensityStale(true), mDensityCounted(0), mLodThreshold(DEFAULT_LOD_THRESHOLD), mTickBirths(0), mTickDeaths(0), mMeanEnergy(0.0f) 
 { 
+    // Cellules dimensionnées sur le plus grand rayon de perception :
+    // une requête ne touche alors qu'un voisinage de 3x3 cellules
+    const float cellSize = MaxPerceptionRadius();
+    mFoodGrid.Configure(width, height, cellSize);
+    mPredatorGrid.Configure(width, height, cellSize);
+    mPreyGrid.Configure(width, height, cellSize);  // Un contact, bien plus court, ne touche que 2x2 cellules
+    mRegions.Configure(width, height);
     // Initialisation des statistiques 
     mStats = {0, 0, 0, 0, 0, 0}; 
-    std::cout << "🌍Écosystème créé: " << width << "x" << height << std::endl; 
+    ECO_LOG(LogLevel::INFO, "🌍Écosystème créé: " << width << "x" << height); 
 } 
 // 🗑 DESTRUCTEUR 
 Ecosystem::~Ecosystem() { 
-    std::cout << "🌍Écosystème détruit (" << mEntities.size() << " entités nettoyé)"<< std::endl; 
+    ECO_LOG(LogLevel::INFO, "🌍Écosystème détruit (" << mEntities.LiveSize() << " entités nettoyé)"); 
  } 
+// 🎲 GRAINE DU GÉNÉRATEUR 
+void Ecosystem::SetSeed(uint32_t seed) { 
+    mSeed = seed; 
+} 
+// 🧵 NOMBRE DE THREADS DE SIMULATION 
+void Ecosystem::SetThreadCount(unsigned threadCount) { 
+    mScheduler = std::make_unique<TaskScheduler>(threadCount); 
+    mWorkerBuffers.assign(mScheduler->GetThreadCount(), WorkerBuffers{}); 
+    mCommands.SetLaneCount(mScheduler->GetThreadCount()); 
+} 
+// 📈 CAPACITÉ DE L'HISTORIQUE 
+void Ecosystem::SetHistoryCapacity(size_t ticks) { 
+    mHistory = StatisticsHistory(ticks); 
+} 
+// 🌾 CHAMP DE NOURRITURE DENSE 
+void Ecosystem::EnableFoodField(float cellSize) { 
+    mFoodField.Configure(mWorldWidth, mWorldHeight, cellSize); 
+    mFoodSources.clear(); 
+} 
+// 💤 RÉGIONS ENDORMIES 
+void Ecosystem::SetSleepingEnabled(bool enabled) { 
+    mChangedRows.clear(); 
+    mRegions.SetEnabled(enabled, mEntities, mChangedRows); 
+    for (size_t row : mChangedRows) MarkRowChanged(row); 
+}
 // INITIALISATION 
 void Ecosystem::Initialize(int initialHerbivores, int initialCarnivores, int initialPlants)
 {
-    mEntities.clear(); 
+    mEntities.Clear(); 
+    // Marge pour les tombes : la compaction les garde sous une ligne sur 8 
+    mEntities.Reserve(mMaxEntities + mMaxEntities / (TOMBSTONE_COMPACTION_DIVISOR - 1)); 
+    mPlants.Clear(); 
+    mRegions.Reset();  // Les nouvelles entités naissent éveillées 
+    mCommands.Clear(); 
+    InvalidateRuns(); 
+    mDensityStale = true; 
+    if (mDomain) { 
+        mDomain->SetLiveCount(0); 
+        mDomain->ClearGhosts(); 
+    }
+    // Horloge des tirages : les entités initiales tirent au tick courant 
+    mEntities.seed = mSeed; 
+    mEntities.tick = static_cast<uint32_t>(mDayCycle); 
+    mWorldRandom = RandomStream(mSeed, WORLD_RANDOM_ENTITY, mEntities.tick, RandomPurpose::WORLD); 
     mFoodSources.clear(); 
+    if (mFoodField.IsActive()) mFoodField.Fill(mSeed, mEntities.tick); 
+    // Les populations repartent de zéro ; l'historique continue 
+    mStats.totalHerbivores = 0; 
+    mStats.totalCarnivores = 0; 
+    mStats.totalPlants = 0; 
     // Création des entités initiales 
     for (int i = 0; i < initialHerbivores; ++i) { 
         SpawnRandomEntity(EntityType::HERBIVORE); 
@@ -39,84 +182,902 @@ void Ecosystem::Initialize(int initialHerbivores, int initialCarnivores, int ini
     }
     // Nourriture initiale (sources statiques de Food)
     SpawnFood(20); 
-    std::cout << "🌱Écosystème initialisé avec " << mEntities.size() << " entités"<< std::endl;
+    ECO_LOG(LogLevel::INFO, "🌱Écosystème initialisé avec " << mEntities.LiveSize() << " entités");
  } 
 // MISE À JOUR 
 void Ecosystem::Update(float deltaTime) { 
-    // Mise à jour de toutes les entités 
-    for (auto& entity : mEntities) { 
-        entity->Update(deltaTime); 
+    ECO_PROFILE_ZONE("Ecosystem::Update"); 
+    // Compteurs du jour remis à zéro au premier tick de chaque jour 
+    if (mDayCycle % TICKS_PER_DAY == 0) { 
+        mStats.birthsToday = 0; 
+        mStats.deathsToday = 0; 
     }
+    mTickBirths = 0; 
+    mTickDeaths = 0; 
+    // Horloge des tirages aléatoires de ce tick 
+    mEntities.tick = static_cast<uint32_t>(mDayCycle); 
+    mWorldRandom = RandomStream(mSeed, WORLD_RANDOM_ENTITY, mEntities.tick, RandomPurpose::WORLD); 
+    // 🧩 Tuiles : migrations et fantômes d'après les positions du début du tick 
+    if (mDomain) ExchangeHalo(deltaTime); 
+    // Horloges et échéances des plantes, séries éveillées, réveils et sommeils des régions 
+    AdvancePlants(deltaTime); 
+    BuildAwakeRuns(); 
+    UpdateRegions(deltaTime); 
+    // État de départ conservé pour l'interpolation du rendu 
+    SavePreviousPositions(); 
+    // Index spatiaux et forces de direction (positions du début du tick) 
+    RebuildSpatialIndex(); 
+    HandleSteering(); 
+    // Mise à jour de toutes les entités, étape par étape sur les colonnes 
+    UpdateEntities(deltaTime); 
+    TrackDensityMoves(); 
     // Gestion des comportements 
     HandleEating(); 
+    if (mFoodField.IsActive()) mFoodField.Step(*mScheduler);  // Diffusion et repousse du champ 
     HandleReproduction(); 
-    RemoveDeadEntities(); 
     HandlePlantGrowth(deltaTime); 
+    // Point de synchronisation : naissances, morts, apparitions et nourriture mangée 
+    ApplyCommands(); 
     // Mise à jour des statistiques 
     UpdateStatistics(); 
     mDayCycle++; 
+    // 🎞 Bloc du tick dans la trace, puis keyframe périodique 
+    if (mTrace) { 
+        mTrace->EndTick(mEntities.tick, deltaTime); 
+        if (mTrace->IsKeyframeDue(static_cast<uint32_t>(mDayCycle))) WriteKeyframe(); 
+    }
 } 
 // GÉNÉRATION DE NOURRITURE 
 void Ecosystem::SpawnFood(int count) { 
     for (int i = 0; i < count; ++i) { 
-        if (mFoodSources.size() < 100) {  // Limite maximale de nourriture 
+        if (mFoodField.IsActive()) { 
+            // Champ dense : la même quantité est déposée dans la cellule tirée, sans limite de nombre 
+            Vector2D position = GetRandomPosition(); 
+            mFoodField.Deposit(position, 25.0f); 
+            if (mTrace) mTrace->RecordFoodSpawn(position, 25.0f); 
+        } else if (mFoodSources.size() < 100) {  // Limite maximale de nourriture 
             Vector2D position = GetRandomPosition(); 
             // La construction doit correspondre à la structure Food
             mFoodSources.emplace_back(position, 25.0f); 
+            if (mTrace) mTrace->RecordFoodSpawn(position, 25.0f); 
         } 
     }
  } 
-// SUPPRESSION DES ENTITÉS MORTES 
+// 📝 APPLICATION DES COMMANDES DU TICK, d'un seul lot et toujours dans le même ordre : 
+// naissances (les morts du tick occupent encore leur place dans la limite d'entités), 
+// morts, nourriture mangée, puis apparitions 
+void Ecosystem::ApplyCommands() { 
+    ECO_PROFILE_ZONE("Ecosystem::ApplyCommands"); 
+    mCommands.Merge(); 
+    // Les enfants sont ajoutés en fin de colonnes, dans l'ordre des parents 
+    if (mDomain) { 
+        ApplyBirthsAcrossTiles(); 
+    } else { 
+        for (size_t parent : mCommands.GetBirths()) { 
+            if (mEntities.LiveSize() >= static_cast<size_t>(mMaxEntities)) break; 
+            GiveBirth(parent); 
+        }
+    }
+    RemoveDeadEntities(); 
+    // Nourriture mangée retirée en une passe stable (indices croissants) 
+    const std::vector<uint32_t>& eaten = mCommands.GetEatenFood(); 
+    if (!eaten.empty()) { 
+        size_t write = 0; 
+        size_t next = 0; 
+        for (size_t read = 0; read < mFoodSources.size(); ++read) { 
+            if (next < eaten.size() && eaten[next] == read) { 
+                ++next; 
+                continue; 
+            }
+            if (write != read) mFoodSources[write] = mFoodSources[read]; 
+            ++write; 
+        }
+        mFoodSources.erase(mFoodSources.begin() + write, mFoodSources.end()); 
+        // Les indices ont changé : la grille de nourriture doit être reconstruite 
+        mFoodGrid.Build(mFoodSources.size(), [this](size_t i) { return mFoodSources[i].position; }); 
+    }
+    for (const EntityCommandBuffer::SpawnCommand& spawn : mCommands.GetSpawns()) { 
+        SpawnEntity(spawn.type, spawn.position); 
+    }
+    mCommands.Clear(); 
+} 
+// 👶 NAISSANCE : l'enfant prend le prochain identifiant, en fin de colonnes 
+void Ecosystem::GiveBirth(size_t parent) { 
+    mEntities.SetEnergy(parent, mEntities.EnergyOf(parent) * 0.6f);  // Coût énergétique de la reproduction 
+    const size_t child = Entity::SpawnChild(mEntities, mEntities, parent); 
+    if (TraitsOf(mEntities.type[child]).clocked) mPlants.Schedule(mEntities, child); 
+    if (mTrace) mTrace->RecordBirth(mEntities.id[parent], mEntities.id[child]); 
+    AdjustPopulation(mEntities.type[child], 1); 
+    mStats.birthsToday++; 
+    mTickBirths++; 
+} 
+// SUPPRESSION DES ENTITÉS MORTES : chaque mort enregistrée devient une tombe, dans l'ordre 
+// des indices ; les colonnes ne sont compactées que lorsque les tombes s'accumulent 
 void Ecosystem::RemoveDeadEntities() { 
-    int initialCount = mEntities.size(); 
-    mEntities.erase( 
-        std::remove_if(mEntities.begin(), mEntities.end(), 
-            [](const std::unique_ptr<Entity>& entity) {  
-                return !entity->IsAlive();  
-            }), 
-        mEntities.end() 
-    ); 
-    int removedCount = initialCount - mEntities.size(); 
-    if (removedCount > 0) { 
-        mStats.deathsToday += removedCount; 
+    ECO_PROFILE_ZONE("Ecosystem::RemoveDeadEntities"); 
+    mCommands.Merge(); 
+    const bool density = mDensity.IsActive() && !mDensityStale; 
+    if (density) CountDensityBirths(); 
+    for (size_t index : mCommands.GetDeaths()) { 
+        // Une proie tuée garde souvent de l'énergie : seule la file sait qu'elle a été mangée 
+        const DeathCause cause = mCommands.IsKill(index) ? DeathCause::PREDATION 
+                                                         : Entity::NaturalDeathCause(mEntities, index); 
+        Entity::LogDeath(mEntities, index, cause); 
+        if (mTrace) mTrace->RecordDeath(mEntities.id[index], cause, mEntities.AgeOf(index)); 
+        ECO_LOG_EVENT(LogLevel::DEBUG, LogEvent::ENTITY_REMOVED, mEntities, index, static_cast<float>(mEntities.AgeOf(index))); 
+        AdjustPopulation(mEntities.type[index], -1); 
+        if (density) mDensity.Remove(mEntities.position[index], mEntities.type[index]); 
+        mEntities.Bury(index); 
+        MarkRowChanged(index); 
+    }
+    const int removedCount = static_cast<int>(mCommands.GetDeaths().size()); 
+    mStats.deathsToday += removedCount; 
+    mTickDeaths += removedCount; 
+    mCommands.ClearDeaths(); 
+    // En tuiles, les lignes ne bougent qu'en tête de tick (fantômes alignés sur les lignes) 
+    if (!mDomain && mEntities.TombstoneCount() * TOMBSTONE_COMPACTION_DIVISOR > mEntities.Size()) { 
+        mEntities.RemoveDead(); 
+        InvalidateRuns(); 
     }
+    if (density) mDensityCounted = mEntities.Size();  // Lignes restantes toutes comptées 
  } 
+// ☠️ MORT IMMÉDIATE (hors des phases du tick) 
+void Ecosystem::MarkDead(size_t index) { 
+    if (!mEntities.alive[index]) return; 
+    // Membre d'une région endormie : l'énergie agrégée de la région ne doit plus le compter 
+    if (mEntities.asleep[index]) WakeRegionOf(index); 
+    mEntities.alive[index] = 0; 
+    mCommands.GetLane(0).deaths.push_back(index); 
+} 
 // GESTION DE LA REPRODUCTION 
 void Ecosystem::HandleReproduction() { 
-    std::vector<std::unique_ptr<Entity>> newEntities; 
-    for (auto& entity : mEntities) { 
-        // Ajout d'une condition plus précise pour le max d'entités
-        if (entity->CanReproduce() && mEntities.size() + newEntities.size() < mMaxEntities) { 
-            auto baby = entity->Reproduce(); 
-            if (baby) { 
-                 newEntities.push_back(std::move(baby)); 
-                mStats.birthsToday++; 
+    ECO_PROFILE_ZONE("Ecosystem::HandleReproduction"); 
+    // Population au maximum : aucun enfant ne pourrait être ajouté 
+    if (LiveCount() >= static_cast<size_t>(mMaxEntities)) return; 
+    // En parallèle : chaque parent éligible tire sa chance dans son propre flux 
+    //    (une plante dormante n'est jamais en âge de se reproduire) 
+    ParallelForAwake([this](size_t begin, size_t end, unsigned worker) { 
+        auto& births = mCommands.GetLane(worker).births; 
+        for (size_t i = begin; i < end; ++i) { 
+            if (!Entity(mEntities, i).CanReproduce()) continue; 
+            // 🎲 Chance de reproduction 
+            if (Entity::ReproductionRoll(mEntities, i) < mEntities.parameters.reproductionChance) { 
+                births.push_back(i); 
             }
-        } 
-    } 
-    // Ajout des nouveaux entités 
-    for (auto& newEntity : newEntities) { 
-        mEntities.push_back(std::move(newEntity)); 
-    } 
+        }
+    }); 
+    // Les enfants naissent au point de synchronisation (ApplyCommands) 
 } 
 // 🍽 GESTION DE L'ALIMENTATION 
 void Ecosystem::HandleEating() { 
-    // Ici on implémenterait la logique de recherche de nourriture 
-    // Pour l'instant, gestion simplifiée 
-    for (auto& entity : mEntities) { 
-        if (entity->GetType() == EntityType::PLANT) { 
-            // Les plantes génèrent de l'énergie 
-            entity->Eat(0.1f); 
-        } 
+    ECO_PROFILE_ZONE("Ecosystem::HandleEating"); 
+    // 1. En parallèle : chaque mangeur de nourriture (herbivores) réclame la plus proche à sa 
+    //    portée (la photosynthèse des plantes est comptée par leur horloge) 
+    ParallelForAwake([this](size_t begin, size_t end, unsigned worker) { 
+        auto& claims = mWorkerBuffers[worker].foodClaims; 
+        for (size_t i = begin; i < end; ++i) { 
+            if (!mEntities.alive[i] || TraitsOf(mEntities.type[i]).diet != Diet::FOOD) continue; 
+            const float reach = mEntities.size[i] / 2.0f + 3.0f; 
+            int nearest = mFoodGrid.FindNearest(mEntities.position[i], reach); 
+            if (nearest >= 0) { 
+                claims.push_back({static_cast<uint32_t>(nearest), static_cast<uint32_t>(i)}); 
+            }
+        }
+    }); 
+    // 2. En série : pour chaque nourriture, le plus petit indice l'emporte 
+    MergeClaims(&WorkerBuffers::foodClaims); 
+    if (mDomain) { 
+        ResolveFoodAcrossTiles(); 
+    } else { 
+        for (const Claim& claim : mMergedClaims) { 
+            Food& food = mFoodSources[claim.target]; 
+            if (food.energyValue <= 0.0f) continue;  // Déjà mangée par un indice plus petit 
+            Entity(mEntities, claim.entity).Eat(food.energyValue); 
+            if (mTrace) mTrace->RecordEat(mEntities.id[claim.entity], food.energyValue); 
+            food.energyValue = 0.0f;  // Consommée, retirée au point de synchronisation 
+            mCommands.EatFood(claim.target); 
+        }
     }
+    if (mFoodField.IsActive()) HandleGrazing(); 
+    HandlePredation(); 
  } 
+// 🦁 PRÉDATION : contacts prédateur-proie par la grille des proies (positions d'après le 
+// mouvement), puis résolution en série dans l'ordre (proie, prédateur) 
+void Ecosystem::HandlePredation() { 
+    ECO_PROFILE_ZONE("Ecosystem::HandlePredation"); 
+    // Aucun chasseur : la grille est inutile (en tuiles, le rang prend part à la résolution commune) 
+    if (mStats.totalCarnivores == 0 && !mDomain) return; 
+    BuildAnimalGrid(mPreyGrid, [this](size_t i) { 
+        return mEntities.alive[i] && TraitsOf(mEntities.type[i]).prey; 
+    }); 
+    if (mPreyGrid.GetItemCount() == 0 && !mDomain) return; 
+    // 1. En parallèle : chaque prédateur réclame la proie la plus proche qu'il touche 
+    ParallelForAwake([this](size_t begin, size_t end, unsigned worker) { 
+        auto& claims = mWorkerBuffers[worker].preyClaims; 
+        for (size_t i = begin; i < end; ++i) { 
+            if (!mEntities.alive[i] || TraitsOf(mEntities.type[i]).diet != Diet::PREY) continue; 
+            const Vector2D position = mEntities.position[i]; 
+            const float halfSize = mEntities.size[i] / 2.0f; 
+            int nearest = -1; 
+            float nearestDistSq = 0.0f; 
+            mPreyGrid.ForEachInRadius(position, halfSize + MaxBodySize() / 2.0f, 
+                [&](uint32_t prey, float distSq) { 
+                    const float contact = halfSize + mEntities.size[prey] / 2.0f; 
+                    if (distSq >= contact * contact || prey == i) return; 
+                    // A distance égale, l'indice le plus petit : indépendant de l'ordre des cellules 
+                    if (nearest < 0 || distSq < nearestDistSq || 
+                        (distSq == nearestDistSq && static_cast<int>(prey) < nearest)) { 
+                        nearest = static_cast<int>(prey); 
+                        nearestDistSq = distSq; 
+                    }
+                }); 
+            if (nearest >= 0) claims.push_back({static_cast<uint32_t>(nearest), static_cast<uint32_t>(i)}); 
+        }
+    }); 
+    // 2. En série : chaque proie revient au plus petit indice qui la touche, 
+    //    un prédateur ne réclamant qu'une proie par tick 
+    MergeClaims(&WorkerBuffers::preyClaims); 
+    if (mDomain) { 
+        ResolvePredationAcrossTiles(); 
+        return; 
+    }
+    for (const Claim& claim : mMergedClaims) { 
+        if (!mEntities.alive[claim.target] || !mEntities.alive[claim.entity]) continue;  // Déjà mangée 
+        const float energy = mEntities.EnergyOf(claim.target); 
+        Entity(mEntities, claim.entity).Eat(energy); 
+        mEntities.alive[claim.target] = 0;  // Retirée avec les autres morts du tick 
+        mCommands.Kill(claim.target); 
+        if (mTrace) mTrace->RecordEat(mEntities.id[claim.entity], energy); 
+    }
+} 
+// 🌾 BROUTAGE DU CHAMP : en série dans l'ordre des indices (deux herbivores peuvent 
+// partager une cellule), chaque prise ne touche qu'une cellule 
+void Ecosystem::HandleGrazing() { 
+    ECO_PROFILE_ZONE("Ecosystem::HandleGrazing"); 
+    for (size_t begin = 0; begin < mEntities.Size(); begin += ENTITY_CHUNK_SIZE) { 
+        const size_t end = std::min(mEntities.Size(), begin + ENTITY_CHUNK_SIZE); 
+        ForEachAwakeRun(begin, end, 0, [this](size_t runBegin, size_t runEnd, unsigned) { 
+            for (size_t i = runBegin; i < runEnd; ++i) { 
+                if (!mEntities.alive[i] || TraitsOf(mEntities.type[i]).diet != Diet::FOOD) continue; 
+                const float hunger = mEntities.maxEnergy[i] - mEntities.energy[i]; 
+                if (hunger <= 0.0f) continue; 
+                mEntities.energy[i] += mFoodField.Consume(mEntities.position[i], std::min(hunger, FOOD_FIELD_GRAZE)); 
+            }
+        }); 
+    }
+} 
+// 🗺 RECONSTRUCTION DES INDEX SPATIAUX 
+void Ecosystem::RebuildSpatialIndex() { 
+    ECO_PROFILE_ZONE("Ecosystem::RebuildSpatialIndex"); 
+    mFoodGrid.Build(mFoodSources.size(), [this](size_t i) { return mFoodSources[i].position; }); 
+    BuildAnimalGrid(mPredatorGrid, [this](size_t i) { 
+        return mEntities.alive[i] && TraitsOf(mEntities.type[i]).predator; 
+    }); 
+} 
+// 🧭 FORCES DE DIRECTION (recherche, fuite, limites du monde) 
+void Ecosystem::HandleSteering() { 
+    ECO_PROFILE_ZONE("Ecosystem::HandleSteering"); 
+    // Chaque entité n'écrit que sa propre vitesse ; les positions lues sont figées. 
+    // Les requêtes de grille remplissent un lot empaqueté par espèce, puis le noyau 
+    // vectoriel calcule recherche, fuite, limites et vitesse de plusieurs entités à la fois 
+    ParallelForEntities([this](size_t begin, size_t end, unsigned worker) { 
+        SteeringBatch* batches = mWorkerBuffers[worker].steering; 
+        ForEachSpecies([batches](auto species) { 
+            using S = decltype(species); 
+            batches[S::index].Clear(); 
+            batches[S::index].maxSpeed = S::traits.maxSpeed; 
+            batches[S::index].avoidRadius = S::traits.avoidRadius; 
+        }); 
+        SpeciesBlock block; 
+        ForEachAwakeRun(begin, end, worker, [this, batches, &block](size_t runBegin, size_t runEnd, unsigned) { 
+            for (size_t blockBegin = runBegin; blockBegin < runEnd; blockBegin += SpeciesBlock::CAPACITY) { 
+                block.Fill(mEntities, blockBegin, std::min(runEnd, blockBegin + SpeciesBlock::CAPACITY)); 
+                block.ForEach([this, batches](auto species, const uint32_t* indices, size_t count) { 
+                    using S = decltype(species); 
+                    GatherSteering<S>(indices, count, batches[S::index]); 
+                }); 
+            }
+        }); 
+        ForEachSpecies([this, batches](auto species) { 
+            using S = decltype(species); 
+            if constexpr (S::traits.moveSpeed > 0.0f) { 
+                SteeringBatch& batch = batches[S::index]; 
+                SteerBatch(batch, mWorldWidth, mWorldHeight); 
+                for (size_t lane = 0; lane < batch.Size(); ++lane) { 
+                    mEntities.velocity[batch.index[lane]] = Vector2D(batch.vx[lane], batch.vy[lane]); 
+                }
+            }
+        }); 
+    }); 
+} 
+// 📦 REMPLISSAGE DU LOT D'UNE ESPÈCE : recherche et fuite n'existent que si ses traits les demandent 
+template <typename S> 
+void Ecosystem::GatherSteering(const uint32_t* indices, size_t count, SteeringBatch& batch) const { 
+    if constexpr (S::traits.moveSpeed > 0.0f) { 
+        for (size_t k = 0; k < count; ++k) { 
+            const size_t i = indices[k]; 
+            const Vector2D position = mEntities.position[i]; 
+            const Vector2D* target = nullptr; 
+            Vector2D uphill; 
+            if constexpr (S::traits.diet == Diet::FOOD && S::traits.seekRadius > 0.0f) { 
+                const int nearest = !mFoodSources.empty() ? mFoodGrid.FindNearest(position, S::traits.seekRadius) : -1; 
+                if (nearest >= 0) target = &mFoodSources[nearest].position; 
+                if (mFoodField.IsActive()) { 
+                    // Champ dense : cible à une cellule dans le sens de la pente 
+                    const Vector2D slope = mFoodField.Gradient(position); 
+                    const float length = std::sqrt(slope.x * slope.x + slope.y * slope.y); 
+                    if (length > 1e-6f) { 
+                        const float step = mFoodField.GetCellSize() / length; 
+                        uphill = Vector2D(position.x + slope.x * step, position.y + slope.y * step); 
+                        target = &uphill; 
+                    }
+                }
+            }
+            batch.Add(static_cast<uint32_t>(i), position, mEntities.velocity[i], target); 
+            if constexpr (S::traits.avoidRadius > 0.0f) { 
+                mPredatorGrid.ForEachInRadius(position, S::traits.avoidRadius, [&](uint32_t predator, float) { 
+                    batch.AddPredator(mEntities.position[predator]); 
+                }); 
+            }
+        }
+    }
+} 
+// ⚙️ ÉTAPES DE VIE (énergie, âge, mouvement, vitalité) EN PARALLÈLE 
+void Ecosystem::UpdateEntities(float deltaTime) { 
+    ECO_PROFILE_ZONE("Ecosystem::UpdateEntities"); 
+    mChunkEnergy.assign((mEntities.Size() + ENTITY_CHUNK_SIZE - 1) / ENTITY_CHUNK_SIZE, ChunkEnergy{0.0, 0}); 
+    ParallelForEntities([this, deltaTime](size_t begin, size_t end, unsigned worker) { 
+        // Les plantes dormantes n'ont rien à faire : leurs horloges ont déjà avancé 
+        ForEachAwakeRun(begin, end, worker, [this, deltaTime](size_t runBegin, size_t runEnd, unsigned runWorker) { 
+            Entity::UpdateRange(mEntities, runBegin, runEnd, deltaTime, mCommands.GetLane(runWorker).deaths); 
+        }); 
+        // Énergie des vivants non endormis relevée tant que la tranche est en cache 
+        ChunkEnergy& chunk = mChunkEnergy[begin / ENTITY_CHUNK_SIZE]; 
+        ForEachRun(&ChunkRuns::present, begin, end, worker, [this, &chunk](size_t runBegin, size_t runEnd, unsigned) { 
+            for (size_t i = runBegin; i < runEnd; ++i) { 
+                if (!mEntities.alive[i] || (mDomain && mDomain->IsGhost(i))) continue; 
+                chunk.energy += mEntities.EnergyOf(i); 
+                chunk.alive++; 
+            }
+        }); 
+    });  
+    // Somme dans l'ordre des tranches : même moyenne quel que soit le nombre de threads 
+    double energy = 0.0; 
+    uint32_t alive = 0; 
+    for (const ChunkEnergy& chunk : mChunkEnergy) { 
+        energy += chunk.energy; 
+        alive += chunk.alive; 
+    }
+    // Entités endormies : énergie agrégée par leurs régions 
+    const WorldRegions::SleepingEnergy& sleeping = mRegions.GetSleepingEnergy(); 
+    energy += sleeping.At(mEntities.plantClocks.growth); 
+    alive += sleeping.count; 
+    mMeanEnergy = alive > 0 ? static_cast<float>(energy / alive) : 0.0f; 
+} 
+// 🌱 HORLOGES DES PLANTES : un tick de vie pour toutes à la fois ; les maturités et 
+// les morts de vieillesse dues sont dépilées (morts enregistrées avec celles du tick) 
+void Ecosystem::AdvancePlants(float deltaTime) { 
+    ECO_PROFILE_ZONE("Ecosystem::AdvancePlants"); 
+    mEntities.plantClocks.age += Entity::AgeIncrement(deltaTime); 
+    mEntities.plantClocks.growth += Entity::PlantGrowth(mEntities, deltaTime); 
+    mChangedRows.clear(); 
+    mPlants.Advance(mEntities, mCommands.GetLane(0).deaths, mChangedRows); 
+    for (size_t row : mChangedRows) MarkRowChanged(row);  // Plantes mûres : hors de leur série dormante 
+} 
+// 💤 RÉGIONS : réveils (voisinage des animaux, échéances) à chaque tick, mises en sommeil 
+// tous les SLEEP_CHECK_INTERVAL ticks ; seules les tranches des lignes concernées sont relevées 
+void Ecosystem::UpdateRegions(float deltaTime) { 
+    if (mDomain) return;  // En tuiles, les lignes bougent à chaque tick : pas de sommeil 
+    mChangedRows.clear(); 
+    if (!(Entity::PlantGrowth(mEntities, deltaTime) > 0.0f)) { 
+        // Énergie des plantes non croissante : les échéances ne tiendraient plus 
+        mRegions.WakeAll(mEntities, mChangedRows); 
+    } else { 
+        mRegions.Wake(mEntities, mAwakeRows, mChangedRows); 
+        if (mRegions.IsEnabled() && mEntities.tick % SLEEP_CHECK_INTERVAL == 0) { 
+            // Candidates : lignes non endormies, série après série 
+            mSleepCandidates.clear(); 
+            for (const ChunkRuns& runs : mChunkRuns) { 
+                for (size_t run = 0; run < runs.present.size(); run += 2) { 
+                    for (uint32_t i = runs.present[run]; i < runs.present[run + 1]; ++i) mSleepCandidates.push_back(i); 
+                }
+            }
+            mRegions.TrySleep(mEntities, mSleepCandidates, mChangedRows); 
+        }
+    }
+    if (mChangedRows.empty()) return; 
+    for (size_t row : mChangedRows) MarkRowChanged(row); 
+    BuildAwakeRuns(); 
+}
+void Ecosystem::WakeRegionOf(size_t index) { 
+    mChangedRows.clear(); 
+    mRegions.WakeAt(mEntities.position[index], mEntities, mChangedRows); 
+    for (size_t row : mChangedRows) MarkRowChanged(row); 
+}
+// 🔍 VUE SUR UNE ENTITÉ : la vue peut la modifier, sa région endormie se réveille 
+Entity Ecosystem::GetEntity(size_t index) { 
+    if (mEntities.asleep[index]) WakeRegionOf(index); 
+    mDensityStale = true;  // Elle peut aussi être déplacée 
+    return Entity(mEntities, index); 
+}
+// 🧵 SÉRIES DE CHAQUE TRANCHE : seules les tranches dont une ligne a changé d'état sont relevées, 
+// avec celles des lignes ajoutées depuis le dernier relevé ; toutes après un déplacement de lignes 
+void Ecosystem::BuildAwakeRuns() { 
+    ECO_PROFILE_ZONE("Ecosystem::BuildAwakeRuns"); 
+    const size_t count = mEntities.Size(); 
+    const size_t chunks = (count + ENTITY_CHUNK_SIZE - 1) / ENTITY_CHUNK_SIZE; 
+    const size_t firstNew = mChunkRuns.empty() ? 0 : std::min(mAwakeCounted, count) / ENTITY_CHUNK_SIZE; 
+    for (uint32_t chunk : mDirtyChunks) { 
+        mChunkDirty[chunk] = 0; 
+        if (chunk < firstNew) ScanChunk(chunk); 
+    }
+    mDirtyChunks.clear(); 
+    mChunkRuns.resize(chunks); 
+    mChunkDirty.resize(chunks, 0); 
+    for (size_t chunk = firstNew; chunk < chunks; ++chunk) ScanChunk(chunk); 
+    // Lignes éveillées dans l'ordre, tranche après tranche 
+    mAwakeRows.clear(); 
+    for (const ChunkRuns& runs : mChunkRuns) { 
+        for (size_t run = 0; run < runs.awake.size(); run += 2) { 
+            for (uint32_t i = runs.awake[run]; i < runs.awake[run + 1]; ++i) mAwakeRows.push_back(i); 
+        }
+    }
+    mAwakeCounted = count; 
+}
+void Ecosystem::ScanChunk(size_t chunk) { 
+    const size_t begin = chunk * ENTITY_CHUNK_SIZE; 
+    const size_t end = std::min(mEntities.Size(), begin + ENTITY_CHUNK_SIZE); 
+    const uint8_t* dormant = mEntities.dormant.data(); 
+    const uint8_t* asleep = mEntities.asleep.data(); 
+    ScanRuns(begin, end, [dormant, asleep](size_t i) { return static_cast<uint8_t>(dormant[i] | asleep[i]); }, 
+             mChunkRuns[chunk].awake); 
+    ScanRuns(begin, end, [asleep](size_t i) { return asleep[i]; }, mChunkRuns[chunk].present); 
+}
+void Ecosystem::MarkRowChanged(size_t index) { 
+    if (mChunkRuns.empty() || index >= mAwakeCounted) return;  // Relevée de toute façon 
+    const size_t chunk = index / ENTITY_CHUNK_SIZE; 
+    if (mChunkDirty[chunk]) return; 
+    mChunkDirty[chunk] = 1; 
+    mDirtyChunks.push_back(static_cast<uint32_t>(chunk)); 
+}
+bool Ecosystem::AwakeRowsCurrent() const { 
+    // En tuiles, les fantômes (dormants) comptent dans les grilles 
+    return !mDomain && !mChunkRuns.empty() && mDirtyChunks.empty() && mAwakeCounted == mEntities.Size(); 
+}
+// 🎞 POSITIONS DU DÉBUT DU TICK (interpolation du rendu) : une entité endormie ne bouge pas 
+void Ecosystem::SavePreviousPositions() { 
+    for (size_t begin = 0; begin < mEntities.Size(); begin += ENTITY_CHUNK_SIZE) { 
+        const size_t end = std::min(mEntities.Size(), begin + ENTITY_CHUNK_SIZE); 
+        ForEachRun(&ChunkRuns::present, begin, end, 0, [this](size_t runBegin, size_t runEnd, unsigned) { 
+            mEntities.SavePreviousPositions(runBegin, runEnd); 
+        }); 
+    }
+}
+// 🗺 CARTE DE DENSITÉ : seules les entités éveillées bougent ; une ligne ajoutée est 
+// comptée une fois, là où elle est née 
+void Ecosystem::TrackDensityMoves() { 
+    if (!mDensity.IsActive() || mDensityStale) return; 
+    const size_t counted = mDensityCounted; 
+    for (size_t begin = 0; begin < counted; begin += ENTITY_CHUNK_SIZE) { 
+        const size_t end = std::min(mEntities.Size(), begin + ENTITY_CHUNK_SIZE); 
+        ForEachAwakeRun(begin, end, 0, [this, counted](size_t runBegin, size_t runEnd, unsigned) { 
+            for (size_t i = runBegin; i < std::min(runEnd, counted); ++i) { 
+                mDensity.Move(mEntities.previousPosition[i], mEntities.position[i], mEntities.type[i]); 
+            }
+        }); 
+    }
+}
+void Ecosystem::CountDensityBirths() const { 
+    for (size_t i = mDensityCounted; i < mEntities.Size(); ++i) mDensity.Add(mEntities.position[i], mEntities.type[i]); 
+    mDensityCounted = mEntities.Size(); 
+}
+// 🧵 OUTILS DE PARALLÉLISME 
+void Ecosystem::ParallelForEntities(const TaskScheduler::RangeTask& body) { 
+    mScheduler->ParallelFor(mEntities.Size(), ENTITY_CHUNK_SIZE, body); 
+} 
+// Demandes des tampons par thread réunies et triées par (cible, mangeur) : 
+// même résolution quel que soit le découpage 
+void Ecosystem::MergeClaims(std::vector<Claim> WorkerBuffers::*buffer) { 
+    mMergedClaims.clear(); 
+    for (auto& buffers : mWorkerBuffers) { 
+        auto& claims = buffers.*buffer; 
+        mMergedClaims.insert(mMergedClaims.end(), claims.begin(), claims.end()); 
+        claims.clear(); 
+    }
+    std::sort(mMergedClaims.begin(), mMergedClaims.end(), [](const Claim& a, const Claim& b) { 
+        return a.target != b.target ? a.target < b.target : a.entity < b.entity; 
+    }); 
+} 
+// 🧩 ÉCHANGE DE BORDURE, en tête de tick : les fantômes du tick précédent disparaissent, 
+// les entités sorties de la tuile partent chez leur nouveau propriétaire, et chaque entité 
+// proche d'une autre tuile y est copiée en fantôme. Tout ce qui arrive est fusionné à sa 
+// place dans l'ordre des identifiants : les départages par indice restent ceux d'un seul processus 
+void Ecosystem::ExchangeHalo(float deltaTime) { 
+    ECO_PROFILE_ZONE("Ecosystem::ExchangeHalo"); 
+    const int rank = mDomain->GetRank(); 
+    const float predatorBand = PredatorHaloBand(); 
+    mTile.preyBand = PreyHaloBand(deltaTime); 
+    mTile.haloOut.assign(mDomain->GetRankCount(), std::vector<HaloRecord>()); 
+    for (size_t i = 0; i < mEntities.Size(); ++i) { 
+        if (mEntities.IsTombstone(i) || !mEntities.alive[i]) continue; 
+        if (mDomain->IsGhost(i)) { 
+            mEntities.alive[i] = 0;  // Copie périmée, ni morte ni comptée 
+            continue; 
+        }
+        const Vector2D position = mEntities.position[i]; 
+        const SpeciesTraits& traits = TraitsOf(mEntities.type[i]); 
+        const int owner = mDomain->OwnerOf(position); 
+        float band = traits.predator ? predatorBand : 0.0f; 
+        if (traits.prey) band = std::max(band, mTile.preyBand); 
+        mTile.ranks.clear(); 
+        if (band > 0.0f) mDomain->RanksNear(position, band, mTile.ranks); 
+        if (owner == rank && mTile.ranks.size() <= 1) continue;  // Loin des bords : rien à envoyer 
+        const EntityRecord record = mEntities.ExportRecord(i); 
+        if (owner != rank) { 
+            mTile.haloOut[owner].push_back({record, 0}); 
+            AdjustPopulation(mEntities.type[i], -1); 
+            mEntities.alive[i] = 0; 
+        }
+        for (int near : mTile.ranks) { 
+            if (near != owner) mTile.haloOut[near].push_back({record, 1}); 
+        }
+    }
+    mEntities.RemoveDead(); 
+    InvalidateRuns(); 
+    mDensityStale = true;  // Départs et arrivées ne passent ni par les naissances ni par les morts 
+    if (!mDomain->Exchange(mTile.haloOut, mTile.haloIn)) { 
+        mDomain->ClearGhosts(); 
+        return; 
+    }
+    mTile.arrivals.clear(); 
+    for (const std::vector<HaloRecord>& received : mTile.haloIn) { 
+        mTile.arrivals.insert(mTile.arrivals.end(), received.begin(), received.end()); 
+    }
+    std::sort(mTile.arrivals.begin(), mTile.arrivals.end(), [](const HaloRecord& a, const HaloRecord& b) { 
+        return a.entity.id < b.entity.id; 
+    }); 
+    mTile.records.clear(); 
+    for (const HaloRecord& arrival : mTile.arrivals) mTile.records.push_back(arrival.entity); 
+    mEntities.MergeRecords(mTile.records, mTile.rows); 
+    std::vector<uint8_t> ghosts(mEntities.Size(), 0); 
+    for (size_t k = 0; k < mTile.rows.size(); ++k) { 
+        const size_t row = mTile.rows[k]; 
+        if (mTile.arrivals[k].ghost) { 
+            ghosts[row] = 1; 
+            mEntities.dormant[row] = 1;  // Hors des boucles du tick : son propriétaire la simule 
+        } else { 
+            AdjustPopulation(mEntities.type[row], 1); 
+            if (TraitsOf(mEntities.type[row]).clocked) mPlants.Schedule(mEntities, row); 
+        }
+    }
+    mDomain->SetGhosts(ghosts); 
+} 
+// 🍽 NOURRITURE EN TUILES : les proies rafraîchissent d'abord leurs fantômes (état d'après le 
+// mouvement), puis toutes les demandes sont réunies ; chaque rang applique la même résolution 
+// (plus petit identifiant par nourriture) à la nourriture répliquée et aux lignes qu'il tient 
+void Ecosystem::ResolveFoodAcrossTiles() { 
+    const int rank = mDomain->GetRank(); 
+    mTile.preyOut.assign(mDomain->GetRankCount(), std::vector<PreyState>()); 
+    for (size_t i = 0; i < mEntities.Size(); ++i) { 
+        if (mEntities.IsTombstone(i) || mDomain->IsGhost(i) || !TraitsOf(mEntities.type[i]).prey) continue; 
+        mTile.ranks.clear(); 
+        mDomain->RanksNear(mEntities.previousPosition[i], mTile.preyBand, mTile.ranks); 
+        if (mTile.ranks.size() <= 1) continue; 
+        const PreyState state = {mEntities.position[i], mEntities.EnergyOf(i), mEntities.id[i], mEntities.alive[i]}; 
+        for (int near : mTile.ranks) { 
+            if (near != rank) mTile.preyOut[near].push_back(state); 
+        }
+    }
+    if (!mDomain->Exchange(mTile.preyOut, mTile.preyIn)) return; 
+    for (const std::vector<PreyState>& received : mTile.preyIn) { 
+        for (const PreyState& state : received) { 
+            const size_t row = mEntities.FindId(state.id); 
+            if (row == SIZE_MAX) continue; 
+            mEntities.position[row] = state.position; 
+            mEntities.SetEnergy(row, state.energy); 
+            mEntities.alive[row] = static_cast<uint8_t>(state.alive); 
+        }
+    }
+    // Demandes en identifiants : (nourriture, mangeur) 
+    for (Claim& claim : mMergedClaims) claim.entity = mEntities.id[claim.entity]; 
+    if (!mDomain->AllGather(mMergedClaims, mTile.claimsIn)) return; 
+    mMergedClaims.clear(); 
+    for (const std::vector<Claim>& received : mTile.claimsIn) { 
+        mMergedClaims.insert(mMergedClaims.end(), received.begin(), received.end()); 
+    }
+    std::sort(mMergedClaims.begin(), mMergedClaims.end(), [](const Claim& a, const Claim& b) { 
+        return a.target != b.target ? a.target < b.target : a.entity < b.entity; 
+    }); 
+    for (const Claim& claim : mMergedClaims) { 
+        Food& food = mFoodSources[claim.target]; 
+        if (food.energyValue <= 0.0f) continue;  // Déjà mangée par un identifiant plus petit 
+        const size_t row = mEntities.FindId(claim.entity); 
+        if (row != SIZE_MAX) Entity(mEntities, row).Eat(food.energyValue);  // Propriétaire ou fantôme 
+        food.energyValue = 0.0f; 
+        mCommands.EatFood(claim.target); 
+    }
+} 
+// 🦁 PRÉDATION EN TUILES : demandes (proie, prédateur) réunies, la première demande de chaque 
+// proie l'emporte ; le rang du prédateur le nourrit (copie de la proie à jour), celui de la 
+// proie enregistre sa mort 
+void Ecosystem::ResolvePredationAcrossTiles() { 
+    for (Claim& claim : mMergedClaims) claim = {mEntities.id[claim.target], mEntities.id[claim.entity]}; 
+    if (!mDomain->AllGather(mMergedClaims, mTile.claimsIn)) return; 
+    mMergedClaims.clear(); 
+    for (const std::vector<Claim>& received : mTile.claimsIn) { 
+        mMergedClaims.insert(mMergedClaims.end(), received.begin(), received.end()); 
+    }
+    std::sort(mMergedClaims.begin(), mMergedClaims.end(), [](const Claim& a, const Claim& b) { 
+        return a.target != b.target ? a.target < b.target : a.entity < b.entity; 
+    }); 
+    // Les prédateurs ne sont pas des proies : seule une proie déjà prise écarte une demande 
+    EntityId taken = INVALID_ENTITY_ID; 
+    for (const Claim& claim : mMergedClaims) { 
+        if (claim.target == taken) continue; 
+        taken = claim.target; 
+        const size_t prey = mEntities.FindId(claim.target); 
+        if (prey == SIZE_MAX) continue; 
+        const size_t predator = mEntities.FindId(claim.entity); 
+        if (predator != SIZE_MAX && !mDomain->IsGhost(predator)) { 
+            Entity(mEntities, predator).Eat(mEntities.EnergyOf(prey)); 
+        }
+        mEntities.alive[prey] = 0; 
+        if (!mDomain->IsGhost(prey)) mCommands.Kill(prey); 
+    }
+} 
+// 👶 NAISSANCES EN TUILES : parents de tous les rangs dans l'ordre des identifiants ; le k-ième 
+// enfant admis dans la limite d'entités reçoit le k-ième identifiant libre, chez son parent 
+void Ecosystem::ApplyBirthsAcrossTiles() { 
+    std::vector<uint32_t> mine; 
+    mine.reserve(mCommands.GetBirths().size() + 1); 
+    mine.push_back(static_cast<uint32_t>(mCommands.GetDeaths().size())); 
+    for (size_t parent : mCommands.GetBirths()) mine.push_back(mEntities.id[parent]); 
+    if (!mDomain->AllGather(mine, mTile.birthsIn)) return; 
+    size_t deaths = 0; 
+    mine.clear(); 
+    for (const std::vector<uint32_t>& received : mTile.birthsIn) { 
+        if (received.empty()) continue; 
+        deaths += received[0]; 
+        mine.insert(mine.end(), received.begin() + 1, received.end()); 
+    }
+    std::sort(mine.begin(), mine.end()); 
+    // Les morts du tick comptent encore dans la limite, comme en un seul processus 
+    const size_t live = mDomain->GetLiveCount(); 
+    const size_t room = live < static_cast<size_t>(mMaxEntities) ? mMaxEntities - live : 0; 
+    const size_t admitted = std::min(mine.size(), room); 
+    const EntityId base = mEntities.GetNextId(); 
+    for (size_t k = 0; k < admitted; ++k) { 
+        const size_t parent = mEntities.FindId(mine[k]); 
+        if (parent == SIZE_MAX || mDomain->IsGhost(parent)) continue; 
+        mEntities.SetNextId(base + static_cast<EntityId>(k)); 
+        GiveBirth(parent); 
+    }
+    mEntities.SetNextId(base + static_cast<EntityId>(admitted)); 
+    mDomain->SetLiveCount(live + admitted - deaths); 
+} 
+// 🔑 EMPREINTE DE L'ÉTAT (FNV-1a sur les colonnes principales) 
+uint64_t Ecosystem::ComputeChecksum() const { 
+    return ComputeChecksum(mEntities, mFoodSources.size(), mFoodField); 
+} 
+uint64_t Ecosystem::ComputeChecksum(const EntityStore& entities, size_t foodCount, const FoodField& foodField) { 
+    uint64_t hash = 14695981039346656037ULL; 
+    auto mix = [&hash](const void* data, size_t bytes) { 
+        const unsigned char* p = static_cast<const unsigned char*>(data); 
+        for (size_t i = 0; i < bytes; ++i) { 
+            hash = (hash ^ p[i]) * 1099511628211ULL; 
+        }
+    }; 
+    // Tombes sautées : même empreinte que les colonnes compactées 
+    const size_t count = entities.LiveSize(); 
+    const bool compact = entities.TombstoneCount() == 0; 
+    auto mixColumn = [&](const auto& column) { 
+        if (compact) { 
+            mix(column.data(), count * sizeof(column[0])); 
+            return; 
+        }
+        for (size_t i = 0; i < entities.Size(); ++i) { 
+            if (!entities.IsTombstone(i)) mix(&column[i], sizeof(column[i])); 
+        }
+    }; 
+    mix(&count, sizeof(count)); 
+    if (count > 0) { 
+        mixColumn(entities.position); 
+        mixColumn(entities.velocity); 
+        // Valeurs courantes : indépendantes de la date du dernier contact d'une plante 
+        for (size_t i = 0; i < entities.Size(); ++i) { 
+            if (compact || !entities.IsTombstone(i)) { 
+                const float energy = entities.EnergyOf(i); 
+                mix(&energy, sizeof(energy)); 
+            }
+        }
+        for (size_t i = 0; i < entities.Size(); ++i) { 
+            if (compact || !entities.IsTombstone(i)) { 
+                const int age = entities.AgeOf(i); 
+                mix(&age, sizeof(age)); 
+            }
+        }
+        mixColumn(entities.type); 
+    }
+    mix(&foodCount, sizeof(foodCount)); 
+    if (foodField.IsActive()) { 
+        // Cellules intérieures seulement : la bordure n'est qu'une copie de travail 
+        const int columns = foodField.GetColumns(); 
+        for (int row = 0; row < foodField.GetRows(); ++row) { 
+            mix(&foodField.GetCells()[static_cast<size_t>(row + 1) * (columns + 2) + 1], columns * sizeof(float)); 
+        }
+    }
+    return hash; 
+} 
+// 💾 INSTANTANÉS 
+namespace { 
+// Section WORLD : tout l'état scalaire de l'écosystème 
+struct WorldSnapshot { 
+    float width; 
+    float height; 
+    int32_t maxEntities; 
+    int32_t dayCycle; 
+    uint64_t seed; 
+    int32_t statistics[6]; 
+}; 
+} // namespace 
+bool Ecosystem::WriteSnapshot(const std::string& path) const { 
+    WorldSnapshot world{}; 
+    world.width = mWorldWidth; 
+    world.height = mWorldHeight; 
+    world.maxEntities = mMaxEntities; 
+    world.dayCycle = mDayCycle; 
+    world.seed = mSeed; 
+    const int statistics[6] = {mStats.totalHerbivores, mStats.totalCarnivores, mStats.totalPlants, 
+                               mStats.totalFood, mStats.deathsToday, mStats.birthsToday}; 
+    std::copy(statistics, statistics + 6, world.statistics); 
+    SnapshotWriter writer; 
+    writer.AddCopy(SnapshotSection::WORLD, &world, 1); 
+    writer.AddCopy(SnapshotSection::WORLD_RANDOM, &mWorldRandom, 1); 
+    writer.Add(SnapshotSection::FOOD, mFoodSources); 
+    const FoodFieldShape shape = mFoodField.GetShape(); 
+    if (mFoodField.IsActive()) { 
+        writer.AddCopy(SnapshotSection::FOOD_FIELD_SHAPE, &shape, 1); 
+        writer.Add(SnapshotSection::FOOD_FIELD, mFoodField.GetCells()); 
+    }
+    mEntities.SaveSnapshot(writer); 
+    return writer.Write(path, ComputeChecksum()); 
+} 
+bool Ecosystem::SaveSnapshot(const std::string& path) const { 
+    if (!WriteSnapshot(path)) return false; 
+    ECO_LOG(LogLevel::INFO, "💾Instantané écrit: " << path << " (" << mEntities.LiveSize() << " entités, tick " << mDayCycle << ")"); 
+    return true; 
+} 
+bool Ecosystem::LoadSnapshot(const std::string& path) { 
+    SnapshotReader reader; 
+    if (!reader.Open(path)) return false; 
+    // Chargement à part : l'écosystème n'est remplacé que si tout est valide 
+    WorldSnapshot world; 
+    EntityStore entities; 
+    std::vector<Food> food; 
+    if (!reader.ReadValue(SnapshotSection::WORLD, world) || !reader.Read(SnapshotSection::FOOD, food)) return false; 
+    // Flux du monde : absent des instantanés sans trace, il repart alors du début du tick 
+    RandomStream worldRandom(world.seed, WORLD_RANDOM_ENTITY, static_cast<uint32_t>(world.dayCycle), RandomPurpose::WORLD); 
+    if (reader.Has(SnapshotSection::WORLD_RANDOM) && !reader.ReadValue(SnapshotSection::WORLD_RANDOM, worldRandom)) return false; 
+    if (!(world.width > 0.0f) || !(world.height > 0.0f) || world.maxEntities < 0) { 
+        std::cerr << "❌ Instantané incohérent : dimensions du monde invalides" << std::endl; 
+        return false; 
+    }
+    // Champ de nourriture : présent seulement si l'instantané a été pris avec un champ 
+    FoodField foodField; 
+    if (reader.Has(SnapshotSection::FOOD_FIELD_SHAPE)) { 
+        FoodFieldShape shape; 
+        std::vector<float> cells; 
+        if (!reader.ReadValue(SnapshotSection::FOOD_FIELD_SHAPE, shape) || 
+            !reader.Read(SnapshotSection::FOOD_FIELD, cells)) return false; 
+        if (shape.columns <= 0 || shape.rows <= 0 || !(shape.cellSize > 0.0f)) { 
+            std::cerr << "❌ Instantané incohérent : champ de nourriture invalide" << std::endl; 
+            return false; 
+        }
+        foodField.Configure(shape); 
+        if (!foodField.SetCells(cells)) return false; 
+    }
+    if (!entities.LoadSnapshot(reader)) return false; 
+    std::swap(mEntities, entities); 
+    std::swap(mFoodSources, food); 
+    std::swap(mFoodField, foodField); 
+    if (ComputeChecksum() != reader.GetChecksum()) { 
+        std::swap(mEntities, entities); 
+        std::swap(mFoodSources, food); 
+        std::swap(mFoodField, foodField); 
+        std::cerr << "❌ Instantané corrompu (empreinte différente): " << path << std::endl; 
+        return false; 
+    }
+    // Marge des tombes bornée par les lignes lues : maxEntities vient de l'en-tête et n'est pas vérifié 
+    const size_t rows = mEntities.Size(); 
+    mEntities.Reserve(rows + rows / (TOMBSTONE_COMPACTION_DIVISOR - 1)); 
+    mWorldWidth = world.width; 
+    mWorldHeight = world.height; 
+    mMaxEntities = world.maxEntities; 
+    mDayCycle = world.dayCycle; 
+    mSeed = world.seed; 
+    mStats = {world.statistics[0], world.statistics[1], world.statistics[2], 
+              world.statistics[3], world.statistics[4], world.statistics[5]}; 
+    RecountPopulation();  // Les compteurs incrémentaux repartent de l'état chargé 
+    mHistory.Clear(); 
+    const float cellSize = MaxPerceptionRadius(); 
+    mFoodGrid.Configure(mWorldWidth, mWorldHeight, cellSize); 
+    mPredatorGrid.Configure(mWorldWidth, mWorldHeight, cellSize); 
+    mPreyGrid.Configure(mWorldWidth, mWorldHeight, cellSize); 
+    mPlants.Rebuild(mEntities);  // Échéances et plantes dormantes recalculées depuis les horloges 
+    mRegions.Configure(mWorldWidth, mWorldHeight);  // Les entités chargées sont éveillées 
+    mCommands.Clear(); 
+    InvalidateRuns(); 
+    mDensityStale = true; 
+    // Même horloge qu'au début d'un tick : le prochain Update reprend exactement 
+    mEntities.seed = mSeed; 
+    mEntities.tick = static_cast<uint32_t>(mDayCycle); 
+    mWorldRandom = worldRandom; 
+    ECO_LOG(LogLevel::INFO, "📂Instantané chargé: " << path << " (" << mEntities.LiveSize() << " entités, tick " << mDayCycle << ")"); 
+    return true; 
+} 
+// 🎞 TRACE D'ÉVÉNEMENTS 
+void Ecosystem::SetTraceRecorder(TraceRecorder* recorder) { 
+    mTrace = recorder; 
+    if (mTrace) WriteKeyframe(); 
+} 
+void Ecosystem::WriteKeyframe() { 
+    ECO_PROFILE_ZONE("Ecosystem::WriteKeyframe"); 
+    const uint32_t tick = static_cast<uint32_t>(mDayCycle); 
+    if (WriteSnapshot(mTrace->GetKeyframePath(tick))) { 
+        mTrace->RecordKeyframe(tick); 
+        ECO_LOG(LogLevel::DEBUG, "🔑Keyframe de trace au tick " << tick); 
+    }
+} 
+bool Ecosystem::ReplayTo(const std::string& tracePath, uint32_t tick) { 
+    TraceReader reader; 
+    uint32_t keyframeTick = 0; 
+    if (!reader.Open(tracePath)) return false; 
+    if (!reader.SeekToKeyframe(tick, keyframeTick)) { 
+        std::cerr << "❌ Aucune keyframe avant le tick " << tick << " dans " << tracePath << std::endl; 
+        return false; 
+    }
+    if (!LoadSnapshot(reader.GetKeyframePath(keyframeTick))) return false; 
+    // La reconstruction n'est pas elle-même enregistrée 
+    TraceRecorder* recorder = mTrace; 
+    mTrace = nullptr; 
+    TraceTick recorded; 
+    while (static_cast<uint32_t>(mDayCycle) < tick && reader.Next(recorded)) { 
+        if (recorded.tick != static_cast<uint32_t>(mDayCycle)) break;  // Trace discontinue 
+        // Entrées utilisateur appliquées avant le tick, comme à l'enregistrement 
+        for (const TraceRecord& record : recorded.records) { 
+            if (record.event == TraceEvent::INPUT_RESET) { 
+                Initialize(static_cast<int>(record.entity), static_cast<int>(record.other), static_cast<int>(record.extra)); 
+            } else if (record.event == TraceEvent::INPUT_SPAWN_FOOD) { 
+                SpawnFood(static_cast<int>(record.entity)); 
+            }
+        }
+        Update(recorded.deltaTime); 
+    }
+    mTrace = recorder; 
+    if (static_cast<uint32_t>(mDayCycle) != tick) { 
+        std::cerr << "❌ La trace s'arrête au tick " << mDayCycle << " avant le tick " << tick << std::endl; 
+        return false; 
+    }
+    ECO_LOG(LogLevel::INFO, "🎞Tick " << tick << " reconstruit depuis la keyframe " << keyframeTick 
+            << " (" << (tick - keyframeTick) << " ticks rejoués)"); 
+    return true; 
+} 
+// 🔍 REQUÊTES SPATIALES 
+int Ecosystem::FindNearestFood(Vector2D position, float radius) const { 
+    return mFoodGrid.FindNearest(position, radius); 
+} 
+void Ecosystem::QueryPredators(Vector2D position, float radius, std::vector<uint32_t>& out) const { 
+    mPredatorGrid.QueryRadius(position, radius, out); 
+} 
 
 // --- MÉTHODES DE GESTION 
 
 void Ecosystem::AddEntity(std::unique_ptr<Entity> entity) {
-    if (mEntities.size() < mMaxEntities) {
-        // Le std::unique_ptr est transféré (move) dans le vecteur
-        mEntities.push_back(std::move(entity));
+    if (entity && mEntities.LiveSize() < static_cast<size_t>(mMaxEntities)) {
+        // Les données de l'entité détachée sont recopiées dans les colonnes
+        entity->CopyInto(mEntities);
+        if (TraitsOf(mEntities.type.back()).clocked) mPlants.Schedule(mEntities, mEntities.Size() - 1);
+        AdjustPopulation(mEntities.type.back(), 1);
     }
 }
 
@@ -132,79 +1093,154 @@ void Ecosystem::AddFood(Vector2D position, float energy) {
 }
 
 
-// MISE À JOUR DES STATISTIQUES 
+// MISE À JOUR DES STATISTIQUES : les populations sont déjà à jour, le tick est archivé 
   void Ecosystem::UpdateStatistics() { 
-    mStats.totalHerbivores = 0; 
-    mStats.totalCarnivores = 0; 
-    mStats.totalPlants = 0; 
-    mStats.totalFood = mFoodSources.size(); 
-    mStats.deathsToday = 0; 
-    mStats.birthsToday = 0;
-    for (const auto& entity : mEntities) { 
-        switch (entity->GetType()) { 
-            case EntityType::HERBIVORE: 
-                mStats.totalHerbivores++; 
-                break; 
-            case EntityType::CARNIVORE: 
-                mStats.totalCarnivores++; 
-                break; 
-            case EntityType::PLANT: 
-                mStats.totalPlants++; 
-                break; 
-        } 
-    }
+    ECO_PROFILE_ZONE("Ecosystem::UpdateStatistics"); 
+    // Champ dense : nourriture comptée en portions de 25 d'énergie, comme les sources discrètes 
+    mStats.totalFood = mFoodField.IsActive() ? static_cast<int>(mFoodField.GetTotal() / 25.0) 
+                                             : static_cast<int>(mFoodSources.size()); 
+    mHistory.Push({static_cast<uint32_t>(mDayCycle), mStats.totalHerbivores, mStats.totalCarnivores, 
+                   mStats.totalPlants, mTickBirths, mTickDeaths, mStats.totalFood, mMeanEnergy}); 
  } 
-// CRÉATION D'ENTITÉ ALÉATOIRE 
-void Ecosystem::SpawnRandomEntity(EntityType type) { 
-    if (mEntities.size() >= mMaxEntities) return; 
-    Vector2D position = GetRandomPosition(); 
-    std::string name; 
+// 🔢 COMPTEURS DE POPULATION 
+void Ecosystem::AdjustPopulation(EntityType type, int delta) { 
     switch (type) { 
         case EntityType::HERBIVORE: 
-            // L'implémentation de ces fonctions est incomplète mais acceptable pour l'instant
-            name = "Herbivore_" + std::to_string(mStats.totalHerbivores); 
+            mStats.totalHerbivores += delta; 
             break; 
         case EntityType::CARNIVORE: 
-            name = "Carnivore_" + std::to_string(mStats.totalCarnivores); 
+            mStats.totalCarnivores += delta; 
             break; 
         case EntityType::PLANT: 
-            name = "Plant_" + std::to_string(mStats.totalPlants); 
+            mStats.totalPlants += delta; 
             break; 
+    } 
+} 
+void Ecosystem::RecountPopulation() { 
+    mStats.totalHerbivores = 0; 
+    mStats.totalCarnivores = 0; 
+    mStats.totalPlants = 0; 
+    for (size_t i = 0; i < mEntities.Size(); ++i) { 
+        if (mEntities.alive[i]) AdjustPopulation(mEntities.type[i], 1); 
     }
-    // Ligne problématique: nécessite que le constructeur Entity(type, position, name) existe
-    mEntities.push_back(std::make_unique<Entity>(type, position, name)); 
+} 
+size_t Ecosystem::LiveCount() const { 
+    return mDomain ? mDomain->GetLiveCount() : mEntities.LiveSize(); 
+} 
+// CRÉATION D'ENTITÉ ALÉATOIRE 
+void Ecosystem::SpawnRandomEntity(EntityType type) { 
+    if (LiveCount() >= static_cast<size_t>(mMaxEntities)) return; 
+    SpawnEntity(type, GetRandomPosition()); 
+} 
+// CRÉATION D'ENTITÉ À UNE POSITION DONNÉE 
+void Ecosystem::SpawnEntity(EntityType type, Vector2D position) { 
+    if (LiveCount() >= static_cast<size_t>(mMaxEntities)) return; 
+    if (mDomain) { 
+        // Décision prise par tous les rangs : seul le propriétaire crée l'entité, 
+        // les autres sautent son identifiant 
+        mDomain->SetLiveCount(mDomain->GetLiveCount() + 1); 
+        if (!mDomain->Owns(position)) { 
+            mEntities.SetNextId(mEntities.GetNextId() + 1); 
+            return; 
+        }
+    }
+    // Création directe dans les colonnes ; la direction initiale vient du flux de l'entité.
+    // Pas de nom stocké : "Herbivore_<id>" est formaté seulement quand on l'affiche
+    const size_t index = Entity::Spawn(mEntities, type, position); 
+    if (TraitsOf(type).clocked) mPlants.Schedule(mEntities, index); 
+    AdjustPopulation(type, 1); 
+    if (mTrace) mTrace->RecordSpawn(mEntities.id[index], type, position); 
 } 
 // POSITION ALÉATOIRE 
 Vector2D Ecosystem::GetRandomPosition() { 
-    std::uniform_real_distribution<float> distX(0.0f, mWorldWidth); 
-    std::uniform_real_distribution<float> distY(0.0f, mWorldHeight); 
-    return Vector2D(distX(mRandomGenerator), distY(mRandomGenerator)); 
+    float x = mWorldRandom.Uniform(0.0f, mWorldWidth); 
+    float y = mWorldRandom.Uniform(0.0f, mWorldHeight); 
+    return Vector2D(x, y); 
 } 
 // CROISSANCE DES PLANTES 
 void Ecosystem::HandlePlantGrowth(float deltaTime) { 
+    ECO_PROFILE_ZONE("Ecosystem::HandlePlantGrowth"); 
     // Occasionnellement, faire pousser de nouvelles plantes 
-    std::uniform_real_distribution<float> chance(0.0f, 1.0f); 
-    if (chance(mRandomGenerator) < 0.01f && mEntities.size() < mMaxEntities) { 
-        SpawnRandomEntity(EntityType::PLANT); 
+    // Chance et position tirées en un seul lot : (chance, x, y) 
+    float draws[3]; 
+    FillUniformSequence(mSeed, WORLD_RANDOM_ENTITY, mEntities.tick, RandomPurpose::PLANT_GROWTH, 3, draws); 
+    // Apparition enregistrée : la limite d'entités est vérifiée au point de synchronisation 
+    if (draws[0] < 0.01f) { 
+        mCommands.Spawn(EntityType::PLANT, Vector2D(draws[1] * mWorldWidth, draws[2] * mWorldHeight)); 
     }
  } 
-// RENDU 
-void Ecosystem::Render(SDL_Renderer* renderer) const { 
-    // Rendu de la nourriture 
+// RENDU : l'image est capturée puis dessinée, comme par le thread de rendu du moteur 
+void Ecosystem::Render(SDL_Renderer* renderer, float alpha) const { 
+    ECO_PROFILE_ZONE("Ecosystem::Render"); 
+    CaptureFrame(mRenderFrame); 
+    // Fond, carte de densité, puis corps et barres d'énergie par-dessus 
+    const RenderView view; 
+    mRenderBatch.Begin(); 
+    mRenderFrame.DrawBackground(mRenderBatch, view); 
+    mRenderBatch.Flush(renderer); 
+    mDensityTexture.Apply(renderer, mRenderFrame); 
+    mDensityTexture.Draw(renderer, mRenderFrame, view); 
+    mRenderBatch.Begin(); 
+    mRenderFrame.DrawEntities(mRenderBatch, alpha, view); 
+    mRenderBatch.Flush(renderer); 
+} 
+// 📸 CAPTURE DE L'ÉTAT DESSINABLE 
+void Ecosystem::CaptureFrame(RenderFrame& frame, const RenderView& view) const { 
+    ECO_PROFILE_ZONE("Ecosystem::CaptureFrame"); 
+    frame.background.clear(); 
+    // Champ dense : une case par cellule assez fournie, plus opaque quand elle est pleine 
+    if (mFoodField.IsActive() && mFoodField.GetCapacity() > 0.0f) { 
+        const float cellSize = mFoodField.GetCellSize(); 
+        const float threshold = 0.1f * mFoodField.GetCapacity(); 
+        for (int row = 0; row < mFoodField.GetRows(); ++row) { 
+            for (int column = 0; column < mFoodField.GetColumns(); ++column) { 
+                const float energy = mFoodField.At(column, row); 
+                if (energy < threshold) continue; 
+                const Vector2D center((column + 0.5f) * cellSize, (row + 0.5f) * cellSize); 
+                if (!view.Contains(center, cellSize)) continue; 
+                const float fill = std::min(energy / mFoodField.GetCapacity(), 1.0f); 
+                frame.background.push_back({column * cellSize, row * cellSize, cellSize, cellSize, 
+                                            Color(0, 150, 0, static_cast<uint8_t>(40.0f + 120.0f * fill))}); 
+            }
+        }
+    }
+    // Nourriture 
     for (const auto& food : mFoodSources) { 
-        SDL_FRect rect = { 
-            food.position.x - 3.0f, 
-            food.position.y - 3.0f, 
-            6.0f, 
-            6.0f 
-        };
-        SDL_SetRenderDrawColor(renderer, food.color.r, food.color.g, food.color.b, food.color.a);
-        SDL_RenderFillRect(renderer, &rect); 
-    }
-    // Rendu des entités 
-    for (const auto& entity : mEntities) { 
-        entity->Render(renderer); 
+        if (!view.Contains(food.position, 3.0f)) continue; 
+        frame.background.push_back({food.position.x - 3.0f, food.position.y - 3.0f, 6.0f, 6.0f, food.color}); 
+    }
+    // Niveau de détail : plein sous la moitié du seuil, nul au seuil, fondu entre les deux 
+    frame.density.columns = 0; 
+    if (mLodThreshold > 0) { 
+        if (!mDensity.Matches(mWorldWidth, mWorldHeight)) { 
+            mDensity.Configure(mWorldWidth, mWorldHeight); 
+            mDensityStale = true; 
+        }
+        if (mDensityStale) { 
+            mDensity.Recount(mEntities); 
+            mDensityCounted = mEntities.Size(); 
+            mDensityStale = false; 
+        } else { 
+            CountDensityBirths(); 
+        }
+        frame.visibleEntities = mDensity.CountVisible(view); 
+        const float threshold = static_cast<float>(mLodThreshold); 
+        frame.detail = std::clamp((threshold - static_cast<float>(frame.visibleEntities)) / (0.5f * threshold), 
+                                  0.0f, 1.0f); 
+        mDensity.TakeDirty(frame.density); 
+    } else { 
+        frame.detail = 1.0f; 
+    }
+    // Entités vivantes dans la vue, inutiles quand seule la carte est dessinée 
+    frame.ClearEntities(); 
+    if (frame.detail > 0.0f) { 
+        Entity::CaptureRange(mEntities, 0, mEntities.Size(), view, frame); 
     }
+    if (mLodThreshold == 0) frame.visibleEntities = frame.GetEntityCount(); 
+    frame.serial = ++mCaptureCount; 
+    frame.tick = static_cast<uint32_t>(mDayCycle); 
+    frame.worldWidth = mWorldWidth; 
+    frame.worldHeight = mWorldHeight; 
 } 
 } // namespace Core 
 } // namespace Ecosystem
\ No newline at end of file
@@ -0,0 +1,363 @@
+#include "Core/EnsembleRunner.h"
+#include "Core/Ecosystem.h"
+#include "Core/Random.h"
+#include "Core/SimulationConfig.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace Ecosystem {
+namespace Core {
+
+namespace {
+
+// 🏷 Noms des paramètres dans le fichier de description, dans l'ordre d'EnsembleParameter
+const char* const PARAMETER_NAMES[ENSEMBLE_PARAMETER_COUNT] = {
+    "herbivores",           "carnivores",           "plants",           "max-entities",
+    "metabolism-herbivore", "metabolism-carnivore", "metabolism-plant", "reproduction-chance"};
+
+// Les populations et la capacité sont des nombres entiers d'entités
+bool IsCount(EnsembleParameter parameter) {
+    return parameter <= EnsembleParameter::MAX_ENTITIES;
+}
+
+bool FindParameter(const std::string& name, EnsembleParameter& out) {
+    for (size_t i = 0; i < ENSEMBLE_PARAMETER_COUNT; ++i) {
+        if (name == PARAMETER_NAMES[i]) {
+            out = static_cast<EnsembleParameter>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Valeur acceptable pour le paramètre ; les plantes évoluent en forme close
+// et ne peuvent donc pas perdre d'énergie : leur métabolisme reste négatif ou nul
+bool IsValidValue(EnsembleParameter parameter, double value) {
+    if (!std::isfinite(value)) return false;
+    switch (parameter) {
+        case EnsembleParameter::HERBIVORES:
+        case EnsembleParameter::CARNIVORES:
+        case EnsembleParameter::PLANTS:
+            return value >= 0.0 && value <= 0x7fffffff && value == std::floor(value);
+        case EnsembleParameter::MAX_ENTITIES:
+            return value >= 1.0 && value <= 0x7fffffff && value == std::floor(value);
+        case EnsembleParameter::METABOLISM_PLANT:
+            return value <= 0.0;
+        case EnsembleParameter::REPRODUCTION_CHANCE:
+            return value >= 0.0 && value <= 1.0;
+        default:
+            return true;
+    }
+}
+
+template <typename T>
+void AppendBytes(std::vector<unsigned char>& out, const T* data, size_t count) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    out.insert(out.end(), bytes, bytes + count * sizeof(T));
+}
+
+// 🧪 UN RUN COMPLET : renvoie son bloc du fichier de résultats
+std::vector<unsigned char> SimulateRun(const EnsembleSpec& spec, const EnsembleRun& run) {
+    const auto count = [&run](EnsembleParameter parameter) {
+        return static_cast<int>(run.values[static_cast<size_t>(parameter)]);
+    };
+    const size_t interval = static_cast<size_t>(spec.sampleInterval);
+
+    Ecosystem world(spec.worldWidth, spec.worldHeight, count(EnsembleParameter::MAX_ENTITIES));
+    world.SetSeed(run.seed);
+    world.SetThreadCount(1);  // Le parallélisme est entre les runs
+    world.SetHistoryCapacity(interval);
+    world.SetParameters(run.GetWorldParameters());
+    if (spec.foodField) world.EnableFoodField();
+    world.Initialize(count(EnsembleParameter::HERBIVORES), count(EnsembleParameter::CARNIVORES),
+                     count(EnsembleParameter::PLANTS));
+
+    const size_t expected = static_cast<size_t>(spec.ticks) / interval + 1;
+    std::vector<uint32_t> ticks;
+    std::vector<int32_t> columns[6];  // herbivores, carnivores, plants, births, deaths, food
+    std::vector<float> meanEnergy;
+    ticks.reserve(expected);
+    for (auto& column : columns) column.reserve(expected);
+    meanEnergy.reserve(expected);
+
+    long long lastSample = 0;
+    for (long long tick = 1; tick <= spec.ticks; ++tick) {
+        world.Update(spec.deltaTime);
+        if (tick % spec.sampleInterval != 0 && tick != spec.ticks) continue;
+        const StatisticsHistory& history = world.GetHistory();
+        const StatisticsSample& sample = history.Latest();
+        const size_t span = static_cast<size_t>(tick - lastSample);
+        lastSample = tick;
+        ticks.push_back(sample.tick);
+        columns[0].push_back(sample.herbivores);
+        columns[1].push_back(sample.carnivores);
+        columns[2].push_back(sample.plants);
+        columns[3].push_back(static_cast<int32_t>(history.Sum(&StatisticsSample::births, span)));
+        columns[4].push_back(static_cast<int32_t>(history.Sum(&StatisticsSample::deaths, span)));
+        columns[5].push_back(sample.food);
+        meanEnergy.push_back(sample.meanEnergy);
+    }
+
+    EnsembleRunHeader header{};
+    header.index = run.index;
+    header.seed = run.seed;
+    header.sampleCount = static_cast<uint32_t>(ticks.size());
+    std::copy(run.values, run.values + ENSEMBLE_PARAMETER_COUNT, header.values);
+    header.checksum = world.ComputeChecksum();
+
+    std::vector<unsigned char> block;
+    block.reserve(sizeof(header) + ticks.size() * ENSEMBLE_COLUMN_COUNT * 4);
+    AppendBytes(block, &header, 1);
+    AppendBytes(block, ticks.data(), ticks.size());
+    for (const auto& column : columns) AppendBytes(block, column.data(), column.size());
+    AppendBytes(block, meanEnergy.data(), meanEnergy.size());
+    return block;
+}
+
+} // namespace
+
+// 🏗 VALEURS PAR DÉFAUT : celles de la ligne de commande et de la table des traits
+EnsembleSpec::EnsembleSpec() {
+    const SimulationConfig config;
+    const WorldParameters parameters = DefaultWorldParameters();
+    worldWidth = config.worldWidth;
+    worldHeight = config.worldHeight;
+    deltaTime = config.fixedDeltaTime;
+    defaults[static_cast<size_t>(EnsembleParameter::HERBIVORES)] = config.initialHerbivores;
+    defaults[static_cast<size_t>(EnsembleParameter::CARNIVORES)] = config.initialCarnivores;
+    defaults[static_cast<size_t>(EnsembleParameter::PLANTS)] = config.initialPlants;
+    defaults[static_cast<size_t>(EnsembleParameter::MAX_ENTITIES)] = config.maxEntities;
+    defaults[static_cast<size_t>(EnsembleParameter::METABOLISM_HERBIVORE)] =
+        parameters.metabolism[static_cast<size_t>(EntityType::HERBIVORE)];
+    defaults[static_cast<size_t>(EnsembleParameter::METABOLISM_CARNIVORE)] =
+        parameters.metabolism[static_cast<size_t>(EntityType::CARNIVORE)];
+    defaults[static_cast<size_t>(EnsembleParameter::METABOLISM_PLANT)] =
+        parameters.metabolism[static_cast<size_t>(EntityType::PLANT)];
+    defaults[static_cast<size_t>(EnsembleParameter::REPRODUCTION_CHANCE)] = parameters.reproductionChance;
+}
+
+// 📂 LECTURE DE LA DESCRIPTION
+bool EnsembleSpec::Load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "❌ Impossible d'ouvrir la description de l'ensemble: " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        const size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+        std::istringstream tokens(line);
+        std::string key;
+        if (!(tokens >> key)) continue;
+
+        bool ok = true;
+        EnsembleParameter parameter;
+        if (key == "mode") {
+            std::string value;
+            ok = static_cast<bool>(tokens >> value) && (value == "grid" || value == "lhs");
+            if (ok) mode = value == "grid" ? Mode::GRID : Mode::LATIN_HYPERCUBE;
+        } else if (key == "samples") {
+            ok = static_cast<bool>(tokens >> samples) && samples > 0;
+        } else if (key == "replicates") {
+            ok = static_cast<bool>(tokens >> replicates) && replicates > 0;
+        } else if (key == "ticks") {
+            ok = static_cast<bool>(tokens >> ticks) && ticks > 0;
+        } else if (key == "seed") {
+            ok = static_cast<bool>(tokens >> seed);
+        } else if (key == "width") {
+            ok = static_cast<bool>(tokens >> worldWidth) && worldWidth > 0.0f;
+        } else if (key == "height") {
+            ok = static_cast<bool>(tokens >> worldHeight) && worldHeight > 0.0f;
+        } else if (key == "dt") {
+            ok = static_cast<bool>(tokens >> deltaTime) && deltaTime > 0.0f;
+        } else if (key == "sample-interval") {
+            ok = static_cast<bool>(tokens >> sampleInterval) && sampleInterval > 0;
+        } else if (key == "food-field") {
+            foodField = true;
+        } else if (FindParameter(key, parameter)) {
+            Axis axis{parameter, {}};
+            double value;
+            while (tokens >> value) {
+                ok = ok && IsValidValue(parameter, value);
+                axis.values.push_back(value);
+            }
+            ok = ok && tokens.eof() && !axis.values.empty();
+            for (const Axis& other : axes) ok = ok && other.parameter != parameter;
+            if (ok) axes.push_back(axis);
+        } else {
+            std::cerr << "❌ Clé inconnue ligne " << lineNumber << " de " << path << ": " << key << std::endl;
+            return false;
+        }
+        // Rien ne doit suivre la valeur d'une clé simple
+        std::string extra;
+        if (ok && (tokens >> extra)) ok = false;
+        if (!ok) {
+            std::cerr << "❌ Valeur invalide ligne " << lineNumber << " de " << path << ": " << key << std::endl;
+            return false;
+        }
+    }
+    if (mode == Mode::LATIN_HYPERCUBE) {
+        if (samples <= 0) {
+            std::cerr << "❌ Hypercube latin sans 'samples': " << path << std::endl;
+            return false;
+        }
+        for (const Axis& axis : axes) {
+            if (axis.values.size() != 2 || axis.values[0] > axis.values[1]) {
+                std::cerr << "❌ Hypercube latin : '" << PARAMETER_NAMES[static_cast<size_t>(axis.parameter)]
+                          << "' attend min max: " << path << std::endl;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ⚙️ PARAMÈTRES DU MONDE D'UN RUN
+WorldParameters EnsembleRun::GetWorldParameters() const {
+    WorldParameters parameters = DefaultWorldParameters();
+    parameters.metabolism[static_cast<size_t>(EntityType::HERBIVORE)] =
+        static_cast<float>(values[static_cast<size_t>(EnsembleParameter::METABOLISM_HERBIVORE)]);
+    parameters.metabolism[static_cast<size_t>(EntityType::CARNIVORE)] =
+        static_cast<float>(values[static_cast<size_t>(EnsembleParameter::METABOLISM_CARNIVORE)]);
+    parameters.metabolism[static_cast<size_t>(EntityType::PLANT)] =
+        static_cast<float>(values[static_cast<size_t>(EnsembleParameter::METABOLISM_PLANT)]);
+    parameters.reproductionChance =
+        static_cast<float>(values[static_cast<size_t>(EnsembleParameter::REPRODUCTION_CHANCE)]);
+    return parameters;
+}
+
+// 🧮 DÉVELOPPEMENT DE L'ENSEMBLE
+std::vector<EnsembleRun> ExpandEnsemble(const EnsembleSpec& spec) {
+    std::vector<EnsembleRun> points;
+    EnsembleRun base{};
+    std::copy(spec.defaults, spec.defaults + ENSEMBLE_PARAMETER_COUNT, base.values);
+
+    if (spec.mode == EnsembleSpec::Mode::GRID) {
+        // Produit cartésien, le premier axe variant le plus lentement
+        size_t pointCount = 1;
+        for (const auto& axis : spec.axes) pointCount *= axis.values.size();
+        points.assign(pointCount, base);
+        for (size_t point = 0; point < pointCount; ++point) {
+            size_t rest = point;
+            for (size_t a = spec.axes.size(); a-- > 0;) {
+                const auto& axis = spec.axes[a];
+                points[point].values[static_cast<size_t>(axis.parameter)] = axis.values[rest % axis.values.size()];
+                rest /= axis.values.size();
+            }
+        }
+    } else {
+        // Hypercube latin : chaque axe coupé en samples strates, chaque strate
+        // utilisée une seule fois, dans un ordre propre à l'axe
+        const size_t sampleCount = static_cast<size_t>(spec.samples);
+        points.assign(sampleCount, base);
+        std::vector<uint32_t> strata(sampleCount);
+        for (const auto& axis : spec.axes) {
+            const size_t parameter = static_cast<size_t>(axis.parameter);
+            RandomStream random(spec.seed, static_cast<uint32_t>(parameter), 0, RandomPurpose::ENSEMBLE_SAMPLE);
+            for (size_t i = 0; i < sampleCount; ++i) strata[i] = static_cast<uint32_t>(i);
+            for (size_t i = sampleCount; i > 1; --i) {
+                std::swap(strata[i - 1], strata[random.NextUInt() % i]);
+            }
+            const double low = axis.values[0], high = axis.values[1];
+            for (size_t i = 0; i < sampleCount; ++i) {
+                const double unit = (strata[i] + static_cast<double>(random.NextFloat())) / sampleCount;
+                double value = low + (high - low) * unit;
+                if (IsCount(axis.parameter)) value = std::min(std::round(value), std::floor(high));
+                points[i].values[parameter] = value;
+            }
+        }
+    }
+
+    // Réplicats consécutifs, une graine par run
+    std::vector<EnsembleRun> runs;
+    runs.reserve(points.size() * static_cast<size_t>(spec.replicates));
+    for (const EnsembleRun& point : points) {
+        for (int replicate = 0; replicate < spec.replicates; ++replicate) {
+            EnsembleRun run = point;
+            run.index = static_cast<uint32_t>(runs.size());
+            run.seed = spec.seed + run.index;
+            runs.push_back(run);
+        }
+    }
+    return runs;
+}
+
+// 🏁 EXÉCUTION
+bool EnsembleRunner::Run(const EnsembleSpec& spec, const std::string& outputPath, unsigned workerCount,
+                         Report& report) {
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<EnsembleRun> runs = ExpandEnsemble(spec);
+
+    std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "❌ Impossible d'écrire les résultats de l'ensemble: " << outputPath << std::endl;
+        return false;
+    }
+    EnsembleFileHeader header{};
+    std::memcpy(header.magic, ENSEMBLE_MAGIC, sizeof(ENSEMBLE_MAGIC));
+    header.version = ENSEMBLE_VERSION;
+    header.runCount = static_cast<uint32_t>(runs.size());
+    header.parameterCount = static_cast<uint32_t>(ENSEMBLE_PARAMETER_COUNT);
+    header.columnCount = static_cast<uint32_t>(ENSEMBLE_COLUMN_COUNT);
+    header.sampleInterval = static_cast<uint32_t>(spec.sampleInterval);
+    header.ticks = static_cast<uint64_t>(spec.ticks);
+    header.deltaTime = spec.deltaTime;
+    header.worldWidth = spec.worldWidth;
+    header.worldHeight = spec.worldHeight;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (workerCount == 0) workerCount = std::max(1u, std::thread::hardware_concurrency());
+    workerCount = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(workerCount, runs.size())));
+
+    // 📤 Blocs terminés en attente de leurs prédécesseurs
+    std::mutex outputMutex;
+    std::vector<std::vector<unsigned char>> finished(runs.size());
+    std::vector<uint8_t> ready(runs.size(), 0);
+    size_t nextToWrite = 0;
+    std::atomic<size_t> nextRun{0};
+    std::atomic<bool> failed{false};
+
+    const auto worker = [&]() {
+        for (size_t i = nextRun++; i < runs.size() && !failed; i = nextRun++) {
+            std::vector<unsigned char> block = SimulateRun(spec, runs[i]);
+            std::lock_guard<std::mutex> lock(outputMutex);
+            finished[i] = std::move(block);
+            ready[i] = 1;
+            while (nextToWrite < runs.size() && ready[nextToWrite]) {
+                const auto& bytes = finished[nextToWrite];
+                file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+                std::vector<unsigned char>().swap(finished[nextToWrite]);
+                ++nextToWrite;
+            }
+            file.flush();
+            if (!file) failed = true;
+        }
+    };
+    std::vector<std::thread> threads;
+    for (unsigned w = 1; w < workerCount; ++w) threads.emplace_back(worker);
+    worker();  // Le thread appelant est le worker 0
+    for (auto& thread : threads) thread.join();
+
+    if (failed || !file) {
+        std::cerr << "❌ Écriture des résultats de l'ensemble incomplète: " << outputPath << std::endl;
+        return false;
+    }
+    report.runs = runs.size();
+    report.workers = workerCount;
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+} // namespace Core
+} // namespace Ecosystem
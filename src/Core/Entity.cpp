@@ -1,157 +1,298 @@
 #include "Core/Entity.h"
+#include "Core/Logger.h"
+#include "Core/Steering.h"
 #include <cmath>
-#include <iostream>
 #include <algorithm>
+#include <random>
 
 namespace Ecosystem {
 namespace Core {
-const float MAX_STEERING_FORCE = 0.5f; // Force maximale de direction
-const float SEEK_RADIUS = 150.0f;      // Rayon dans lequel l'entité cherche sa nourriture
 
-// 🏗 CONSTRUCTEUR PRINCIPAL
-Entity::Entity(EntityType type, Vector2D pos, std::string entityName)
-    : mType(type), position(pos), name(entityName), 
-      mRandomGenerator(std::random_device{}())  // Initialisation du générateur aléatoire
+// 🏗 CONSTRUCTEUR PRINCIPAL (entité détachée, avec son propre stockage)
+Entity::Entity(EntityType type, Vector2D pos, const std::string& entityName)
+    : mStore(nullptr), mIndex(0), mOwnedStore(std::make_unique<EntityStore>())
 {
-    // 🔧 INITIALISATION SELON LE TYPE
-    switch(mType) {
-        case EntityType::HERBIVORE:
-            mEnergy = 80.0f;
-            mMaxEnergy = 150.0f;
-            mMaxAge = 200;
-            color = Color::Blue();
-            size = 8.0f;
-            break;
-            
-        case EntityType::CARNIVORE:
-            mEnergy = 100.0f;
-            mMaxEnergy = 200.0f;
-            mMaxAge = 150;
-            color = Color::Red();
-            size = 12.0f;
-            break;
-            
-        case EntityType::PLANT:
-            mEnergy = 50.0f;
-            mMaxEnergy = 100.0f;
-            mMaxAge = 300;
-            color = Color::Green();
-            size = 6.0f;
-            break;
-    }
-    
-    mAge = 0;
-    mIsAlive = true;
-    mVelocity = GenerateRandomDirection();
-    
-    std::cout << "🌱 Entité créée: " << name << " à (" << position.x << ", " << position.y << ")" << std::endl;
+    mStore = mOwnedStore.get();
+    // Graine propre à l'entité détachée
+    mStore->seed = (static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}();
+    mIndex = Spawn(*mStore, type, pos, entityName);
 }
 
-// 🏗 CONSTRUCTEUR DE COPIE
+// 👁 VUE SUR UN EMPLACEMENT EXISTANT
+Entity::Entity(EntityStore& store, size_t index)
+    : mStore(&store), mIndex(index) {}
+
+// 🏗 CONSTRUCTEUR DE COPIE : produit un enfant détaché
 Entity::Entity(const Entity& other)
-    : mType(other.mType), position(other.position), name(other.name + "_copy"),
-      mEnergy(other.mEnergy * 0.7f),  // Enfant a moins d'énergie
-      mMaxEnergy(other.mMaxEnergy),
-      mAge(0),  // Nouvelle entité, âge remis à 0
-      mMaxAge(other.mMaxAge),
-      mIsAlive(true),
-      mVelocity(other.mVelocity),
-      color(other.color),
-      size(other.size * 0.8f),  // Enfant plus petit
-      mRandomGenerator(std::random_device{}())
+    : mStore(nullptr), mIndex(0), mOwnedStore(std::make_unique<EntityStore>())
 {
-    std::cout << "👶 Copie d'entité créée: " << name << std::endl;
+    mStore = mOwnedStore.get();
+    mIndex = SpawnChild(*mStore, *other.mStore, other.mIndex);
 }
 
-// 🗑 DESTRUCTEUR
-Entity::~Entity() {
-    std::cout << "💀 Entité détruite: " << name << " (Âge: " << mAge << ")" << std::endl;
+// 🗑 DESTRUCTEUR (une vue ne possède rien ; le stockage détaché est libéré seul)
+Entity::~Entity() = default;
+
+// 🧬 CRÉATION D'UNE ENTITÉ DANS UN STOCKAGE
+size_t Entity::Spawn(EntityStore& store, EntityType type, Vector2D pos, const std::string& entityName) {
+    const size_t i = store.Append();
+    store.type[i] = type;
+    store.position[i] = pos;
+    store.previousPosition[i] = pos;
+    store.nameIndex[i] = store.InternName(entityName);  // Vide : nom généré à partir de l'identifiant
+
+    // 🔧 INITIALISATION SELON L'ESPÈCE
+    const SpeciesTraits& traits = TraitsOf(type);
+    store.energy[i] = traits.initialEnergy;
+    store.maxEnergy[i] = traits.maxEnergy;
+    store.maxAge[i] = traits.maxAge;
+    store.color[i] = traits.color;
+    store.size[i] = traits.size;
+    
+    store.age[i] = 0;
+    store.alive[i] = 1;
+    RandomStream random(store.seed, store.id[i], store.tick, RandomPurpose::SPAWN_DIRECTION);
+    store.velocity[i] = GenerateRandomDirection(random);
+    
+    ECO_LOG_EVENT(LogLevel::DEBUG, LogEvent::ENTITY_SPAWNED, store, i, store.energy[i]);
+    return i;
+}
+
+// 👶 CRÉATION D'UN ENFANT (destination peut être le stockage du parent)
+size_t Entity::SpawnChild(EntityStore& destination, EntityStore& source, size_t parentIndex) {
+    const size_t i = destination.AppendCopy(source, parentIndex);
+    // Le nom est hérité (aucune chaîne construite) ; seule la génération avance
+    const uint16_t parentLineage = source.lineage[parentIndex];
+    destination.lineage[i] = parentLineage < UINT16_MAX ? parentLineage + 1 : parentLineage;
+    destination.energy[i] = source.EnergyOf(parentIndex) * 0.7f;  // Enfant a moins d'énergie
+    destination.age[i] = 0;                                     // Nouvelle entité, âge remis à 0
+    destination.alive[i] = 1;
+    destination.size[i] = source.size[parentIndex] * 0.8f;      // Enfant plus petit
+    destination.previousPosition[i] = destination.position[i];   // Pas d'interpolation depuis l'ancien état du parent
+
+    ECO_LOG_EVENT(LogLevel::DEBUG, LogEvent::ENTITY_BORN, destination, i, destination.energy[i]);
+    return i;
+}
+
+// 📦 ADOPTION PAR UN AUTRE STOCKAGE
+size_t Entity::CopyInto(EntityStore& destination) const {
+    return destination.AppendCopy(*mStore, mIndex);
 }
 
 // ⚙️ MISE À JOUR PRINCIPALE
 void Entity::Update(float deltaTime) {
-    if (!mIsAlive) return;
-    
-    // 🔄 PROCESSUS DE VIE
-    ConsumeEnergy(deltaTime);
-    Age(deltaTime);
-    Move(deltaTime);
-    CheckVitality();
+    // Entité détachée : aucun écosystème ne fait avancer les horloges de son stockage
+    if (mOwnedStore) {
+        mStore->plantClocks.age += AgeIncrement(deltaTime);
+        mStore->plantClocks.growth += PlantGrowth(*mStore, deltaTime);
+    }
+    std::vector<size_t> deaths;
+    UpdateRange(*mStore, mIndex, mIndex + 1, deltaTime, deaths);
+    if (!deaths.empty()) LogDeath(*mStore, mIndex, NaturalDeathCause(*mStore, mIndex));
+}
+
+// 🧬 NOYAUX PAR ESPÈCE : chaque étape n'existe que pour les espèces dont les traits la demandent
+template <typename S>
+void Entity::ConsumeSpecies(EntityStore& store, const uint32_t* indices, size_t count, float deltaTime) {
+    if constexpr (!S::traits.clocked) {
+        const float consumption = store.parameters.metabolism[S::index] * deltaTime;
+        for (size_t k = 0; k < count; ++k) store.energy[indices[k]] -= consumption;
+    }
+}
+
+template <typename S>
+void Entity::AgeSpecies(EntityStore& store, const uint32_t* indices, size_t count, float deltaTime) {
+    if constexpr (!S::traits.clocked) {
+        const int ageIncrement = AgeIncrement(deltaTime);
+        for (size_t k = 0; k < count; ++k) store.age[indices[k]] += ageIncrement;
+    }
+}
+
+template <typename S>
+void Entity::MoveSpecies(EntityStore& store, const uint32_t* indices, size_t count, float deltaTime) {
+    if constexpr (S::traits.moveSpeed > 0.0f) {
+        // 🎲 Comportement aléatoire occasionnel : un tirage par identifiant, tout le bloc d'un coup
+        uint32_t ids[SpeciesBlock::CAPACITY];
+        float chances[SpeciesBlock::CAPACITY];
+        for (size_t k = 0; k < count; ++k) ids[k] = store.id[indices[k]];
+        if (count > 0) FillUniform(store.seed, store.tick, RandomPurpose::WANDER, ids, count, chances);
+        for (size_t k = 0; k < count; ++k) {
+            const size_t i = indices[k];
+            if (chances[k] < WANDER_CHANCE) {
+                RandomStream random(store.seed, store.id[i], store.tick, RandomPurpose::WANDER_DIRECTION);
+                store.velocity[i] = GenerateRandomDirection(random);
+            }
+            // 📐 Application du mouvement
+            const Vector2D velocity = store.velocity[i];
+            store.position[i] = store.position[i] + velocity * deltaTime * S::traits.moveSpeed;
+            // 🔄 Consommation d'énergie due au mouvement
+            store.energy[i] -= velocity.Distance(Vector2D(0, 0)) * deltaTime * S::traits.moveCost;
+        }
+    }
+}
+
+template <typename S>
+void Entity::CheckSpecies(EntityStore& store, const uint32_t* indices, size_t count, size_t blockBegin, uint8_t* died) {
+    for (size_t k = 0; k < count; ++k) {
+        const size_t i = indices[k];
+        float energy;
+        int age;
+        if constexpr (S::traits.clocked) {
+            energy = store.ClockedEnergyOf(i);
+            age = store.ClockedAgeOf(i);
+        } else {
+            energy = store.energy[i];
+            age = store.age[i];
+        }
+        if (energy <= 0.0f || age >= store.maxAge[i]) {
+            store.alive[i] = 0;
+            died[i - blockBegin] = 1;
+        }
+    }
+}
+
+// ⚙️ MISE À JOUR PAR LOTS : bloc par bloc, chaque espèce passe par ses propres noyaux
+void Entity::UpdateRange(EntityStore& store, size_t begin, size_t end, float deltaTime,
+                         std::vector<size_t>& deaths) {
+    SpeciesBlock block;
+    uint8_t died[SpeciesBlock::CAPACITY];
+    for (size_t blockBegin = begin; blockBegin < end; blockBegin += SpeciesBlock::CAPACITY) {
+        const size_t blockEnd = std::min(end, blockBegin + SpeciesBlock::CAPACITY);
+        block.Fill(store, blockBegin, blockEnd);
+        std::fill(died, died + (blockEnd - blockBegin), 0);
+        // 🔄 PROCESSUS DE VIE (chaque entité ne touche que ses propres colonnes)
+        block.ForEach([&](auto species, const uint32_t* indices, size_t count) {
+            using S = decltype(species);
+            ConsumeSpecies<S>(store, indices, count, deltaTime);
+            AgeSpecies<S>(store, indices, count, deltaTime);
+            MoveSpecies<S>(store, indices, count, deltaTime);
+            CheckSpecies<S>(store, indices, count, blockBegin, died);
+        });
+        // Morts rendues dans l'ordre des indices, quelle que soit leur espèce
+        for (size_t k = 0; k < blockEnd - blockBegin; ++k) {
+            if (died[k]) deaths.push_back(blockBegin + k);
+        }
+    }
 }
 
 // 🚶 MOUVEMENT
 void Entity::Move(float deltaTime) {
-    if (mType == EntityType::PLANT) return;  // Les plantes ne bougent pas
-    
-    // 🎲 Comportement aléatoire occasionnel
-    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
-    if (chance(mRandomGenerator) < 0.02f) {
-        mVelocity = GenerateRandomDirection();
+    MoveRange(*mStore, mIndex, mIndex + 1, deltaTime);
+}
+
+void Entity::MoveRange(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    SpeciesBlock block;
+    for (size_t blockBegin = begin; blockBegin < end; blockBegin += SpeciesBlock::CAPACITY) {
+        block.Fill(store, blockBegin, std::min(end, blockBegin + SpeciesBlock::CAPACITY));
+        block.ForEach([&](auto species, const uint32_t* indices, size_t count) {
+            MoveSpecies<decltype(species)>(store, indices, count, deltaTime);
+        });
     }
-    
-    // 📐 Application du mouvement
-    position = position + mVelocity * deltaTime * 20.0f;
-    
-    // 🔄 Consommation d'énergie due au mouvement
-    mEnergy -= mVelocity.Distance(Vector2D(0, 0)) * deltaTime * 0.1f;
+}
+
+// 🧭 APPLICATION D'UNE FORCE DE DIRECTION
+void Entity::ApplyForce(Vector2D force) {
+    mStore->velocity[mIndex] = Steering::ApplyForce(mStore->velocity[mIndex], force, TraitsOf(GetType()).maxSpeed);
 }
 
 // 🍽 MANGER
 void Entity::Eat(float energy) {
-    mEnergy += energy;
-    if (mEnergy > mMaxEnergy) {
-        mEnergy = mMaxEnergy;
+    float current = mStore->EnergyOf(mIndex) + energy;
+    if (current > mStore->maxEnergy[mIndex]) {
+        current = mStore->maxEnergy[mIndex];
     }
-    std::cout << "🍽 " << name << " mange et gagne " << energy << " énergie" << std::endl;
+    mStore->SetEnergy(mIndex, current);
+    ECO_LOG_EVENT(LogLevel::TRACE, LogEvent::ENTITY_ATE, *mStore, mIndex, energy);
 }
 
 // 🔄 CONSOMMATION D'ÉNERGIE
 void Entity::ConsumeEnergy(float deltaTime) {
-    float baseConsumption = 0.0f;
-    
-    switch(mType) {
-        case EntityType::HERBIVORE:
-            baseConsumption = 1.5f;
-            break;
-        case EntityType::CARNIVORE:
-            baseConsumption = 2.0f;
-            break;
-        case EntityType::PLANT:
-            baseConsumption = -0.5f;  // Les plantes génèrent de l'énergie !
-            break;
+    ConsumeEnergyRange(*mStore, mIndex, mIndex + 1, deltaTime);
+}
+
+void Entity::ConsumeEnergyRange(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    SpeciesBlock block;
+    for (size_t blockBegin = begin; blockBegin < end; blockBegin += SpeciesBlock::CAPACITY) {
+        block.Fill(store, blockBegin, std::min(end, blockBegin + SpeciesBlock::CAPACITY));
+        block.ForEach([&](auto species, const uint32_t* indices, size_t count) {
+            ConsumeSpecies<decltype(species)>(store, indices, count, deltaTime);
+        });
     }
-    
-    mEnergy -= baseConsumption * deltaTime;
+}
+
+float Entity::PlantGrowth(const EntityStore& store, float deltaTime) {
+    const float metabolism = store.parameters.metabolism[static_cast<size_t>(EntityType::PLANT)];
+    return -metabolism * deltaTime + PLANT_PHOTOSYNTHESIS;
 }
 
 // 🎂 VIEILLISSEMENT
 void Entity::Age(float deltaTime) {
-    mAge += static_cast<int>(deltaTime * 10.0f);  // Accéléré pour la simulation
+    AgeRange(*mStore, mIndex, mIndex + 1, deltaTime);
+}
+
+int Entity::AgeIncrement(float deltaTime) {
+    return static_cast<int>(deltaTime * 10.0f);  // Accéléré pour la simulation
+}
+
+void Entity::AgeRange(EntityStore& store, size_t begin, size_t end, float deltaTime) {
+    SpeciesBlock block;
+    for (size_t blockBegin = begin; blockBegin < end; blockBegin += SpeciesBlock::CAPACITY) {
+        block.Fill(store, blockBegin, std::min(end, blockBegin + SpeciesBlock::CAPACITY));
+        block.ForEach([&](auto species, const uint32_t* indices, size_t count) {
+            AgeSpecies<decltype(species)>(store, indices, count, deltaTime);
+        });
+    }
 }
 
 // ❤️ VÉRIFICATION DE LA SANTÉ
 void Entity::CheckVitality() {
-    if (mEnergy <= 0.0f || mAge >= mMaxAge) {
-        mIsAlive = false;
-        std::cout << "💀 " << name << " meurt - ";
-        if (mEnergy <= 0) std::cout << "Faim";
-        else std::cout << "Vieillesse";
-        std::cout << std::endl;
+    std::vector<size_t> deaths;
+    CheckVitalityRange(*mStore, mIndex, mIndex + 1, deaths);
+    if (!deaths.empty()) LogDeath(*mStore, mIndex, NaturalDeathCause(*mStore, mIndex));
+}
+
+void Entity::CheckVitalityRange(EntityStore& store, size_t begin, size_t end,
+                                std::vector<size_t>& deaths) {
+    SpeciesBlock block;
+    uint8_t died[SpeciesBlock::CAPACITY];
+    for (size_t blockBegin = begin; blockBegin < end; blockBegin += SpeciesBlock::CAPACITY) {
+        const size_t blockEnd = std::min(end, blockBegin + SpeciesBlock::CAPACITY);
+        block.Fill(store, blockBegin, blockEnd);
+        std::fill(died, died + (blockEnd - blockBegin), 0);
+        block.ForEach([&](auto species, const uint32_t* indices, size_t count) {
+            CheckSpecies<decltype(species)>(store, indices, count, blockBegin, died);
+        });
+        for (size_t k = 0; k < blockEnd - blockBegin; ++k) {
+            if (died[k]) deaths.push_back(blockBegin + k);
+        }
     }
 }
 
+DeathCause Entity::NaturalDeathCause(const EntityStore& store, size_t index) {
+    return store.EnergyOf(index) <= 0.0f ? DeathCause::STARVATION : DeathCause::OLD_AGE;
+}
+
+void Entity::LogDeath(const EntityStore& store, size_t index, DeathCause cause) {
+    ECO_LOG_EVENT(LogLevel::DEBUG, LogEvent::ENTITY_DIED, store, index, static_cast<float>(store.AgeOf(index)),
+                  static_cast<uint8_t>(cause));
+}
+
 // 👶 REPRODUCTION
 bool Entity::CanReproduce() const {
-    return mIsAlive && mEnergy > mMaxEnergy * 0.8f && mAge > 20;
+    return IsAlive() && GetEnergy() > mStore->maxEnergy[mIndex] * 0.8f && GetAge() > REPRODUCTION_MIN_AGE;
+}
+
+// Tirage de reproduction du tick courant : même valeur quel que soit l'appelant ou le thread
+float Entity::ReproductionRoll(const EntityStore& store, size_t index) {
+    return RandomStream(store.seed, store.id[index], store.tick, RandomPurpose::REPRODUCTION).NextFloat();
 }
 
 std::unique_ptr<Entity> Entity::Reproduce() {
     if (!CanReproduce()) return nullptr;
     
     // 🎲 Chance de reproduction
-    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
-    if (chance(mRandomGenerator) < 0.3f) {
-        mEnergy *= 0.6f;  // Coût énergétique de la reproduction
+    if (ReproductionRoll(*mStore, mIndex) < mStore->parameters.reproductionChance) {
+        mStore->SetEnergy(mIndex, mStore->EnergyOf(mIndex) * 0.6f);  // Coût énergétique de la reproduction
         return std::make_unique<Entity>(*this);  // Utilise le constructeur de copie
     }
     
@@ -159,16 +300,17 @@ std::unique_ptr<Entity> Entity::Reproduce() {
 }
 
 // 🎲 GÉNÉRATION DE DIRECTION ALÉATOIRE
-Vector2D Entity::GenerateRandomDirection() {
-    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
-    return Vector2D(dist(mRandomGenerator), dist(mRandomGenerator));
+Vector2D Entity::GenerateRandomDirection(RandomStream& random) {
+    float x = random.Uniform(-1.0f, 1.0f);
+    float y = random.Uniform(-1.0f, 1.0f);
+    return Vector2D(x, y);
 }
 
 // 🎨 CALCUL DE LA COULEUR BASÉE SUR L'ÉTAT
-Color Entity::CalculateColorBasedOnState() const {
-    float energyRatio = GetEnergyPercentage();
+Color Entity::CalculateColorBasedOnState(const EntityStore& store, size_t index) {
+    float energyRatio = store.EnergyOf(index) / store.maxEnergy[index];
     
-    Color baseColor = color;
+    Color baseColor = store.color[index];
     
     // 🔴 Rouge si faible énergie
     if (energyRatio < 0.3f) {
@@ -181,21 +323,24 @@ Color Entity::CalculateColorBasedOnState() const {
 }
 
 Vector2D Entity::SeekFood(const std::vector<Food>& foodSources) const {
-    if (foodSources.empty() || mType == EntityType::CARNIVORE) {
-        // Seuls les herbivores cherchent cette nourriture, et si la liste est vide.
+    const SpeciesTraits& traits = TraitsOf(GetType());
+    if (foodSources.empty() || traits.diet != Diet::FOOD) {
+        // Seules les espèces qui s'en nourrissent cherchent cette nourriture, et si la liste est vide.
         return Vector2D(0, 0);
     }
 
+    const Vector2D position = GetPosition();
+
     // On utilise la distance au carré pour les comparaisons afin d'éviter la fonction std::sqrt()
-    float closestDistSq = SEEK_RADIUS * SEEK_RADIUS; 
+    float closestDistSq = traits.seekRadius * traits.seekRadius; 
     Vector2D targetPosition = Vector2D(0, 0);
     bool foundTarget = false;
 
     // 1. Trouver la source de nourriture la plus proche dans le rayon de recherche
     for (const auto& food : foodSources) {
-        // Vecteur de l'entité à la nourriture (position cible - position actuelle)
-        Vector2D toFood;
-        float distSq; // Assurez-vous que Vector2D a la méthode LengthSq()
+        float dx = food.position.x - position.x;
+        float dy = food.position.y - position.y;
+        float distSq = dx * dx + dy * dy;
 
         if (distSq < closestDistSq) {
             closestDistSq = distSq;
@@ -209,132 +354,119 @@ Vector2D Entity::SeekFood(const std::vector<Food>& foodSources) const {
     }
 
     // 2. Calculer la force de "Seek" (Recherche)
-    
-    // Calculer le vecteur pointant vers la cible
-    Vector2D desiredDirection;
+    return Steering::SeekTowards(position, targetPosition);
+}
 
-    // Le vecteur désiré est la direction normalisée (longueur 1) multipliée par la force maximale
-    Vector2D desiredVelocity; 
+// 🔍 RECHERCHE INDEXÉE : seules les cellules voisines de la grille sont parcourues
+Vector2D Entity::SeekFood(const std::vector<Food>& foodSources, const SpatialGrid& foodGrid) const {
+    const SpeciesTraits& traits = TraitsOf(GetType());
+    if (foodSources.empty() || traits.diet != Diet::FOOD) {
+        return Vector2D(0, 0);
+    }
+
+    const Vector2D position = GetPosition();
 
-    // Retourne la force de direction à appliquer dans Entity::Move/ApplyForce
-    return desiredVelocity;
+    int nearest = foodGrid.FindNearest(position, traits.seekRadius);
+    if (nearest < 0) {
+        return Vector2D(0, 0); // Aucune nourriture trouvée à portée
+    }
+    return Steering::SeekTowards(position, foodSources[nearest].position);
 }
 // ...existing code...
 Vector2D Entity::AvoidPredators(const std::vector<Entity>& predators) const {
-    // Les plantes ne fuient pas; les carnivores ne fuient pas non plus
-    if (mType == EntityType::PLANT || mType == EntityType::CARNIVORE) {
+    // Seules les espèces dotées d'un rayon de fuite fuient (ni plantes ni carnivores)
+    const float avoidRadius = TraitsOf(GetType()).avoidRadius;
+    if (avoidRadius <= 0.0f) {
         return Vector2D(0.0f, 0.0f);
     }
 
-    const float AVOID_RADIUS = 120.0f;
-    const float AVOID_RADIUS_SQ = AVOID_RADIUS * AVOID_RADIUS;
-
+    const Vector2D position = GetPosition();
     Vector2D steer{0.0f, 0.0f};
     float totalWeight = 0.0f;
 
     for (const auto& pred : predators) {
-        // Seuls les prédateurs vivants et de type CARNIVORE sont considérés
-        if (!pred.mIsAlive || pred.mType != EntityType::CARNIVORE) continue;
-
-        float dx = position.x - pred.position.x;
-        float dy = position.y - pred.position.y;
-        float distSq = dx*dx + dy*dy;
-
-        if (distSq > 0.0f && distSq < AVOID_RADIUS_SQ) {
-            // Plus le prédateur est proche, plus la force de fuite est grande.
-            float weight = 1.0f / std::sqrt(distSq); // inverse de la distance
-            steer.x += dx * weight;
-            steer.y += dy * weight;
-            totalWeight += weight;
-        }
+        // Seuls les prédateurs vivants sont considérés
+        if (!pred.IsAlive() || !TraitsOf(pred.GetType()).predator) continue;
+        Steering::AccumulateFlee(position, pred.GetPosition(), steer, totalWeight, avoidRadius);
     }
 
-    if (totalWeight <= 0.0f) {
-        return Vector2D(0.0f, 0.0f); // Aucun prédateur menaçant à portée
-    }
+    // Retourner la force de fuite (steering) à appliquer par Move/ApplyForce
+    return Steering::FinishFlee(steer, totalWeight);
+}
 
-    // Moyenne pondérée
-    steer.x /= totalWeight;
-    steer.y /= totalWeight;
-
-    // Normaliser et appliquer force maximale de direction
-    float len = std::sqrt(steer.x*steer.x + steer.y*steer.y);
-    if (len > 1e-6f) {
-        steer.x = (steer.x / len) * MAX_STEERING_FORCE;
-        steer.y = (steer.y / len) * MAX_STEERING_FORCE;
-    } else {
-        steer = Vector2D(0.0f, 0.0f);
+// 🔍 FUITE INDEXÉE : la grille ne contient que les prédateurs vivants
+Vector2D Entity::AvoidPredators(const EntityStore& store, const SpatialGrid& predatorGrid) const {
+    const float avoidRadius = TraitsOf(GetType()).avoidRadius;
+    if (avoidRadius <= 0.0f) {
+        return Vector2D(0.0f, 0.0f);
     }
 
-    // Retourner la force de fuite (steering) à appliquer par Move/ApplyForce
-    return steer;
+    const Vector2D position = GetPosition();
+    Vector2D steer{0.0f, 0.0f};
+    float totalWeight = 0.0f;
+
+    predatorGrid.ForEachInRadius(position, avoidRadius, [&](uint32_t index, float) {
+        Steering::AccumulateFlee(position, store.position[index], steer, totalWeight, avoidRadius);
+    });
+
+    return Steering::FinishFlee(steer, totalWeight);
 }
 // ...existing code...
 // ...existing code...
 Vector2D Entity::StayInBounds(float worldWidth, float worldHeight) const {
-    // Marge à partir des bords où l'entité commence à corriger sa trajectoire
-    const float MARGIN = 40.0f;
-    Vector2D steer{0.0f, 0.0f};
+    return Steering::StayInBounds(GetPosition(), worldWidth, worldHeight);
+}
+// ...existing code...
 
-    // Calculer une poussée pour ramener l'entité dans la zone sûre
-    if (position.x < MARGIN) {
-        steer.x = (MARGIN - position.x); // pousse vers la droite
-    } else if (position.x > worldWidth - MARGIN) {
-        steer.x = (worldWidth - MARGIN - position.x); // pousse vers la gauche (négatif)
-    }
 
-    if (position.y < MARGIN) {
-        steer.y = (MARGIN - position.y); // pousse vers le bas
-    } else if (position.y > worldHeight - MARGIN) {
-        steer.y = (worldHeight - MARGIN - position.y); // pousse vers le haut (négatif)
-    }
+// 🎨 RENDU GRAPHIQUE
+void Entity::Render(SDL_Renderer* renderer) const {
+    RenderRange(*mStore, mIndex, mIndex + 1, renderer);
+}
 
-    // Si aucune correction n'est nécessaire
-    if (std::abs(steer.x) < 1e-6f && std::abs(steer.y) < 1e-6f) {
-        return Vector2D(0.0f, 0.0f);
-    }
+void Entity::RenderRange(const EntityStore& store, size_t begin, size_t end,
+                         SDL_Renderer* renderer, float alpha) {
+    Graphics::BatchRenderer batch;
+    RenderRange(store, begin, end, batch, alpha);
+    batch.Flush(renderer);
+}
 
-    // Normaliser et appliquer la force maximale de direction
-    float len = std::sqrt(steer.x * steer.x + steer.y * steer.y);
-    if (len > 1e-6f) {
-        steer.x = (steer.x / len) * MAX_STEERING_FORCE;
-        steer.y = (steer.y / len) * MAX_STEERING_FORCE;
+void Entity::RenderRange(const EntityStore& store, size_t begin, size_t end,
+                         Graphics::BatchRenderer& batch, float alpha) {
+    const Color energyColor(0, 255, 0, 255);
+    for (size_t i = begin; i < end; ++i) {
+        if (!store.alive[i]) continue;
+        
+        // Interpolation entre le tick précédent et le tick courant
+        const Vector2D previous = store.previousPosition[i];
+        const Vector2D current = store.position[i];
+        const Vector2D position(previous.x + (current.x - previous.x) * alpha,
+                                previous.y + (current.y - previous.y) * alpha);
+        const float size = store.size[i];
+        Color renderColor = CalculateColorBasedOnState(store, i);
+        
+        batch.AddRect(position.x - size / 2.0f, position.y - size / 2.0f, size, size, renderColor);
+        
+        // 🔵 Indicateur d'énergie (barre de vie)
+        if (!TraitsOf(store.type[i]).clocked) {
+            float energyBarWidth = size * (store.EnergyOf(i) / store.maxEnergy[i]);
+            batch.AddRect(position.x - size / 2.0f, position.y - size / 2.0f - 3.0f,
+                          energyBarWidth, 2.0f, energyColor);
+        }
     }
-
-    return steer;
 }
-// ...existing code...
-
 
-// 🎨 RENDU GRAPHIQUE
-void Entity::Render(SDL_Renderer* renderer) const {
-    if (!mIsAlive) return;
-    
-    Color renderColor = CalculateColorBasedOnState();
-    
-    SDL_FRect rect = {
-        position.x - size / 2.0f,
-        position.y - size / 2.0f,
-        size,
-        size
-    };
-    
-    SDL_SetRenderDrawColor(renderer, renderColor.r, renderColor.g, renderColor.b, renderColor.a);
-    SDL_RenderFillRect(renderer, &rect);
-    
-    // 🔵 Indicateur d'énergie (barre de vie)
-    if (mType != EntityType::PLANT) {
-        float energyBarWidth = size * GetEnergyPercentage();
-        SDL_FRect energyBar = {
-            position.x - size / 2.0f,
-            position.y - size / 2.0f - 3.0f,
-            energyBarWidth,
-            2.0f
-        };
-        SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
-        SDL_RenderFillRect(renderer, &energyBar);
+void Entity::CaptureRange(const EntityStore& store, size_t begin, size_t end, const RenderView& view,
+                          RenderFrame& frame) {
+    for (size_t i = begin; i < end; ++i) {
+        if (!store.alive[i] || !view.Contains(store.position[i], store.size[i])) continue;
+        frame.previousPosition.push_back(store.previousPosition[i]);
+        frame.position.push_back(store.position[i]);
+        frame.size.push_back(store.size[i]);
+        frame.color.push_back(CalculateColorBasedOnState(store, i));
+        frame.energyBar.push_back(!TraitsOf(store.type[i]).clocked ? store.EnergyOf(i) / store.maxEnergy[i] : -1.0f);
     }
 }
 
 } // namespace Core
-} // namespace Ecosystem
\ No newline at end of file
+} // namespace Ecosystem
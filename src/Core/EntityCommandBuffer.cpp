@@ -0,0 +1,33 @@
+#include "Core/EntityCommandBuffer.h"
+
+namespace Ecosystem {
+namespace Core {
+
+// 🔀 RÉUNION : les voies sont vidées dans les listes communes, puis triées
+void EntityCommandBuffer::Merge() {
+    for (Lane& lane : mLanes) {
+        mBirths.insert(mBirths.end(), lane.births.begin(), lane.births.end());
+        mDeaths.insert(mDeaths.end(), lane.deaths.begin(), lane.deaths.end());
+        lane.births.clear();
+        lane.deaths.clear();
+    }
+    std::sort(mBirths.begin(), mBirths.end());
+    std::sort(mDeaths.begin(), mDeaths.end());
+    std::sort(mKills.begin(), mKills.end());
+}
+
+// 🧹 Fin du point de synchronisation : la capacité est gardée pour le tick suivant
+void EntityCommandBuffer::Clear() {
+    for (Lane& lane : mLanes) {
+        lane.births.clear();
+        lane.deaths.clear();
+    }
+    mBirths.clear();
+    mDeaths.clear();
+    mKills.clear();
+    mSpawns.clear();
+    mEatenFood.clear();
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,456 @@
+#include "Core/EntityStore.h"
+#include "Core/Snapshot.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace Ecosystem {
+namespace Core {
+
+// ➕ NOUVEL EMPLACEMENT (emplacement de poignée recyclé si possible)
+size_t EntityStore::Append() {
+    const size_t index = Size();
+    uint32_t slotIndex;
+    if (!mFreeSlots.empty()) {
+        slotIndex = mFreeSlots.back();
+        mFreeSlots.pop_back();
+    } else {
+        slotIndex = static_cast<uint32_t>(mSlots.size());
+        mSlots.push_back({UINT32_MAX, 0});
+    }
+    mSlots[slotIndex].index = static_cast<uint32_t>(index);
+
+    position.emplace_back();
+    previousPosition.emplace_back();
+    velocity.emplace_back();
+    energy.push_back(0.0f);
+    maxEnergy.push_back(1.0f);
+    age.push_back(0);
+    maxAge.push_back(0);
+    type.push_back(EntityType::PLANT);
+    alive.push_back(1);
+    dormant.push_back(0);
+    asleep.push_back(0);
+    ageMark.push_back(plantClocks.age);
+    growthMark.push_back(plantClocks.growth);
+    color.emplace_back();
+    size.push_back(0.0f);
+    nameIndex.push_back(0);
+    lineage.push_back(0);
+    id.push_back(mNextId++);
+    slot.push_back(slotIndex);
+    return index;
+}
+
+// 📋 COPIE D'UNE ENTITÉ (nouvel identifiant dans ce stockage)
+size_t EntityStore::AppendCopy(const EntityStore& source, size_t sourceIndex) {
+    const size_t index = Append();
+    position[index] = source.position[sourceIndex];
+    previousPosition[index] = source.previousPosition[sourceIndex];
+    velocity[index] = source.velocity[sourceIndex];
+    // Valeurs courantes, datées avec les horloges de ce stockage
+    energy[index] = source.EnergyOf(sourceIndex);
+    maxEnergy[index] = source.maxEnergy[sourceIndex];
+    age[index] = source.AgeOf(sourceIndex);
+    maxAge[index] = source.maxAge[sourceIndex];
+    type[index] = source.type[sourceIndex];
+    alive[index] = source.alive[sourceIndex];
+    color[index] = source.color[sourceIndex];
+    size[index] = source.size[sourceIndex];
+    lineage[index] = source.lineage[sourceIndex];
+    // La table des noms est propre à chaque stockage
+    const uint32_t sourceName = source.nameIndex[sourceIndex];
+    nameIndex[index] = (&source == this || sourceName == 0) ? sourceName
+                                                             : InternName(source.mNames[sourceName]);
+    return index;
+}
+
+// 🪦 TOMBE : la ligne reste en place, hors des boucles du tick, jusqu'à la compaction
+void EntityStore::Bury(size_t index) {
+    // La génération avance : les poignées vers cette entité deviennent périmées
+    Slot& freed = mSlots[slot[index]];
+    freed.index = UINT32_MAX;
+    ++freed.generation;
+    mFreeSlots.push_back(slot[index]);
+    alive[index] = 0;
+    dormant[index] = 1;
+    ++mTombstones;
+}
+
+// 🧹 COMPACTION STABLE : l'ordre relatif des survivants est conservé
+size_t EntityStore::RemoveDead() {
+    const size_t count = Size();
+    size_t write = 0;
+    for (size_t read = 0; read < count; ++read) {
+        if (!alive[read]) {
+            // Une tombe a déjà rendu son emplacement (peut-être repris depuis)
+            if (!IsTombstone(read)) {
+                Slot& freed = mSlots[slot[read]];
+                freed.index = UINT32_MAX;
+                ++freed.generation;
+                mFreeSlots.push_back(slot[read]);
+            }
+            continue;
+        }
+        if (write != read) MoveRow(read, write);
+        ++write;
+    }
+    ResizeColumns(write);
+    mTombstones = 0;
+    return count - write;
+}
+
+// 🔀 FUSION PAR IDENTIFIANT : de la fin vers le début, chaque ligne n'est déplacée qu'une fois
+void EntityStore::MergeRecords(const std::vector<EntityRecord>& records, std::vector<size_t>& rows) {
+    rows.resize(records.size());
+    if (records.empty()) return;
+    size_t read = Size();
+    size_t next = records.size();
+    size_t write = Size() + records.size();
+    ResizeColumns(write);
+    while (next > 0) {
+        if (read > 0 && id[read - 1] > records[next - 1].id) {
+            MoveRow(--read, --write);
+            continue;
+        }
+        const EntityRecord& record = records[--next];
+        const size_t index = --write;
+        uint32_t slotIndex;
+        if (!mFreeSlots.empty()) {
+            slotIndex = mFreeSlots.back();
+            mFreeSlots.pop_back();
+        } else {
+            slotIndex = static_cast<uint32_t>(mSlots.size());
+            mSlots.push_back({UINT32_MAX, 0});
+        }
+        mSlots[slotIndex].index = static_cast<uint32_t>(index);
+        position[index] = record.position;
+        previousPosition[index] = record.previousPosition;
+        velocity[index] = record.velocity;
+        energy[index] = record.energy;
+        maxEnergy[index] = record.maxEnergy;
+        age[index] = record.age;
+        maxAge[index] = record.maxAge;
+        type[index] = record.type;
+        alive[index] = record.alive;
+        dormant[index] = 0;
+        asleep[index] = 0;
+        ageMark[index] = record.ageMark;
+        growthMark[index] = record.growthMark;
+        color[index] = record.color;
+        size[index] = record.size;
+        nameIndex[index] = 0;
+        lineage[index] = record.lineage;
+        id[index] = record.id;
+        slot[index] = slotIndex;
+        mNextId = std::max(mNextId, record.id + 1);
+        rows[next] = index;
+    }
+}
+
+EntityRecord EntityStore::ExportRecord(size_t index) const {
+    EntityRecord record;
+    record.position = position[index];
+    record.previousPosition = previousPosition[index];
+    record.velocity = velocity[index];
+    record.ageMark = ageMark[index];
+    record.growthMark = growthMark[index];
+    record.energy = energy[index];
+    record.maxEnergy = maxEnergy[index];
+    record.size = size[index];
+    record.age = age[index];
+    record.maxAge = maxAge[index];
+    record.id = id[index];
+    record.color = color[index];
+    record.lineage = lineage[index];
+    record.type = type[index];
+    record.alive = alive[index];
+    return record;
+}
+
+// 🚚 DÉPLACEMENT D'UNE LIGNE (une tombe n'a plus d'emplacement à mettre à jour)
+void EntityStore::MoveRow(size_t from, size_t to) {
+    const bool buried = IsTombstone(from);
+    position[to] = position[from];
+    previousPosition[to] = previousPosition[from];
+    velocity[to] = velocity[from];
+    energy[to] = energy[from];
+    maxEnergy[to] = maxEnergy[from];
+    age[to] = age[from];
+    maxAge[to] = maxAge[from];
+    type[to] = type[from];
+    alive[to] = alive[from];
+    dormant[to] = dormant[from];
+    asleep[to] = asleep[from];
+    ageMark[to] = ageMark[from];
+    growthMark[to] = growthMark[from];
+    color[to] = color[from];
+    size[to] = size[from];
+    nameIndex[to] = nameIndex[from];
+    lineage[to] = lineage[from];
+    id[to] = id[from];
+    slot[to] = slot[from];
+    if (!buried) mSlots[slot[to]].index = static_cast<uint32_t>(to);
+}
+
+void EntityStore::ResizeColumns(size_t count) {
+    position.resize(count);
+    previousPosition.resize(count);
+    velocity.resize(count);
+    energy.resize(count);
+    maxEnergy.resize(count);
+    age.resize(count);
+    maxAge.resize(count);
+    type.resize(count);
+    alive.resize(count);
+    dormant.resize(count);
+    asleep.resize(count);
+    ageMark.resize(count);
+    growthMark.resize(count);
+    color.resize(count);
+    size.resize(count);
+    nameIndex.resize(count);
+    lineage.resize(count);
+    id.resize(count);
+    slot.resize(count);
+}
+
+// 🗑 VIDAGE COMPLET (les poignées déjà distribuées deviennent périmées)
+void EntityStore::Clear() {
+    for (size_t i = 0; i < Size(); ++i) {
+        if (IsTombstone(i)) continue;
+        const uint32_t slotIndex = slot[i];
+        mSlots[slotIndex].index = UINT32_MAX;
+        ++mSlots[slotIndex].generation;
+        mFreeSlots.push_back(slotIndex);
+    }
+    position.clear();
+    previousPosition.clear();
+    velocity.clear();
+    energy.clear();
+    maxEnergy.clear();
+    age.clear();
+    maxAge.clear();
+    type.clear();
+    alive.clear();
+    dormant.clear();
+    asleep.clear();
+    ageMark.clear();
+    growthMark.clear();
+    color.clear();
+    size.clear();
+    nameIndex.clear();
+    lineage.clear();
+    id.clear();
+    slot.clear();
+    mTombstones = 0;
+}
+
+void EntityStore::Reserve(size_t capacity) {
+    position.reserve(capacity);
+    previousPosition.reserve(capacity);
+    velocity.reserve(capacity);
+    energy.reserve(capacity);
+    maxEnergy.reserve(capacity);
+    age.reserve(capacity);
+    maxAge.reserve(capacity);
+    type.reserve(capacity);
+    alive.reserve(capacity);
+    dormant.reserve(capacity);
+    asleep.reserve(capacity);
+    ageMark.reserve(capacity);
+    growthMark.reserve(capacity);
+    color.reserve(capacity);
+    size.reserve(capacity);
+    nameIndex.reserve(capacity);
+    lineage.reserve(capacity);
+    id.reserve(capacity);
+    slot.reserve(capacity);
+    mSlots.reserve(capacity);
+    mFreeSlots.reserve(capacity);
+}
+
+// 🏷 TABLE DES NOMS
+uint32_t EntityStore::InternName(const std::string& text) {
+    if (text.empty()) return 0;
+    if (mNames.empty()) mNames.emplace_back();  // Entrée 0 réservée au nom généré
+    auto found = mNameLookup.find(text);
+    if (found != mNameLookup.end()) return found->second;
+    const uint32_t entry = static_cast<uint32_t>(mNames.size());
+    mNames.push_back(text);
+    mNameLookup.emplace(text, entry);
+    return entry;
+}
+
+// 🏷 NOM AFFICHÉ, formaté à la demande : "Herbivore_42", ou le nom donné,
+// suivi de "_g<n>" pour une entité née par reproduction
+size_t EntityStore::FormatName(size_t index, char* buffer, size_t capacity) const {
+    char* out = buffer;
+    char* const end = buffer + capacity;
+    auto append = [&](const char* text, size_t length) {
+        const size_t count = std::min(length, static_cast<size_t>(end - out));
+        std::memcpy(out, text, count);
+        out += count;
+    };
+    auto appendNumber = [&](uint32_t value) {
+        char digits[12];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        append(digits, static_cast<size_t>(result.ptr - digits));
+    };
+
+    if (nameIndex[index] != 0) {
+        const std::string& text = mNames[nameIndex[index]];
+        append(text.data(), text.size());
+    } else {
+        const char* prefix = TraitsOf(type[index]).namePrefix;
+        append(prefix, std::strlen(prefix));
+        appendNumber(id[index]);
+    }
+    if (lineage[index] > 0) {
+        append("_g", 2);
+        appendNumber(lineage[index]);
+    }
+    return static_cast<size_t>(out - buffer);
+}
+
+std::string EntityStore::GetName(size_t index) const {
+    char buffer[96];
+    return std::string(buffer, FormatName(index, buffer, sizeof(buffer)));
+}
+
+// 🔍 RECHERCHE PAR POIGNÉE
+size_t EntityStore::IndexOf(EntityHandle handle) const {
+    if (handle.slot >= mSlots.size() || mSlots[handle.slot].generation != handle.generation ||
+        mSlots[handle.slot].index == UINT32_MAX) {
+        return SIZE_MAX;
+    }
+    return mSlots[handle.slot].index;
+}
+
+size_t EntityStore::FindId(EntityId entity) const {
+    auto found = std::lower_bound(id.begin(), id.end(), entity);
+    return found != id.end() && *found == entity ? static_cast<size_t>(found - id.begin()) : SIZE_MAX;
+}
+
+// 💾 SAUVEGARDE : une section par colonne, plus les tables privées
+void EntityStore::SaveSnapshot(SnapshotWriter& writer) const {
+    writer.Add(SnapshotSection::ENTITY_POSITION, position);
+    writer.Add(SnapshotSection::ENTITY_PREVIOUS_POSITION, previousPosition);
+    writer.Add(SnapshotSection::ENTITY_VELOCITY, velocity);
+    writer.Add(SnapshotSection::ENTITY_ENERGY, energy);
+    writer.Add(SnapshotSection::ENTITY_MAX_ENERGY, maxEnergy);
+    writer.Add(SnapshotSection::ENTITY_AGE, age);
+    writer.Add(SnapshotSection::ENTITY_MAX_AGE, maxAge);
+    writer.Add(SnapshotSection::ENTITY_TYPE, type);
+    writer.Add(SnapshotSection::ENTITY_ALIVE, alive);
+    writer.Add(SnapshotSection::ENTITY_COLOR, color);
+    writer.Add(SnapshotSection::ENTITY_SIZE, size);
+    writer.Add(SnapshotSection::ENTITY_NAME_INDEX, nameIndex);
+    writer.Add(SnapshotSection::ENTITY_LINEAGE, lineage);
+    writer.Add(SnapshotSection::ENTITY_ID, id);
+    writer.Add(SnapshotSection::ENTITY_SLOT, slot);
+    writer.Add(SnapshotSection::ENTITY_AGE_MARK, ageMark);
+    writer.Add(SnapshotSection::ENTITY_GROWTH_MARK, growthMark);
+    writer.AddCopy(SnapshotSection::STORE_PLANT_CLOCKS, &plantClocks, 1);
+    writer.AddCopy(SnapshotSection::STORE_PARAMETERS, &parameters, 1);
+
+    writer.AddCopy(SnapshotSection::STORE_STATE, &mNextId, 1);
+    writer.Add(SnapshotSection::STORE_SLOTS, mSlots);
+    writer.Add(SnapshotSection::STORE_FREE_SLOTS, mFreeSlots);
+    std::vector<char> text;
+    std::vector<uint32_t> ends;
+    for (size_t i = 1; i < mNames.size(); ++i) {
+        text.insert(text.end(), mNames[i].begin(), mNames[i].end());
+        ends.push_back(static_cast<uint32_t>(text.size()));
+    }
+    writer.AddCopy(SnapshotSection::STORE_NAME_TEXT, text.data(), text.size());
+    writer.AddCopy(SnapshotSection::STORE_NAME_ENDS, ends.data(), ends.size());
+}
+
+// 📖 RESTAURATION : copie des colonnes puis vérification des invariants
+bool EntityStore::LoadSnapshot(const SnapshotReader& reader) {
+    bool ok = reader.Read(SnapshotSection::ENTITY_POSITION, position) &&
+              reader.Read(SnapshotSection::ENTITY_PREVIOUS_POSITION, previousPosition) &&
+              reader.Read(SnapshotSection::ENTITY_VELOCITY, velocity) &&
+              reader.Read(SnapshotSection::ENTITY_ENERGY, energy) &&
+              reader.Read(SnapshotSection::ENTITY_MAX_ENERGY, maxEnergy) &&
+              reader.Read(SnapshotSection::ENTITY_AGE, age) &&
+              reader.Read(SnapshotSection::ENTITY_MAX_AGE, maxAge) &&
+              reader.Read(SnapshotSection::ENTITY_TYPE, type) &&
+              reader.Read(SnapshotSection::ENTITY_ALIVE, alive) &&
+              reader.Read(SnapshotSection::ENTITY_COLOR, color) &&
+              reader.Read(SnapshotSection::ENTITY_SIZE, size) &&
+              reader.Read(SnapshotSection::ENTITY_NAME_INDEX, nameIndex) &&
+              reader.Read(SnapshotSection::ENTITY_LINEAGE, lineage) &&
+              reader.Read(SnapshotSection::ENTITY_ID, id) &&
+              reader.Read(SnapshotSection::ENTITY_SLOT, slot) &&
+              reader.ReadValue(SnapshotSection::STORE_STATE, mNextId) &&
+              reader.Read(SnapshotSection::STORE_SLOTS, mSlots) &&
+              reader.Read(SnapshotSection::STORE_FREE_SLOTS, mFreeSlots);
+    // Instantanés antérieurs aux horloges des plantes : valeurs datées de l'instant zéro
+    if (ok && reader.Has(SnapshotSection::STORE_PLANT_CLOCKS)) {
+        ok = reader.Read(SnapshotSection::ENTITY_AGE_MARK, ageMark) &&
+             reader.Read(SnapshotSection::ENTITY_GROWTH_MARK, growthMark) &&
+             reader.ReadValue(SnapshotSection::STORE_PLANT_CLOCKS, plantClocks);
+    } else {
+        plantClocks = PlantClocks{};
+        ageMark.assign(Size(), 0);
+        growthMark.assign(Size(), 0.0);
+    }
+    // Instantanés antérieurs aux paramètres réglables : ceux des traits
+    if (ok && reader.Has(SnapshotSection::STORE_PARAMETERS)) {
+        ok = reader.ReadValue(SnapshotSection::STORE_PARAMETERS, parameters);
+    } else {
+        parameters = DefaultWorldParameters();
+    }
+    std::vector<char> text;
+    std::vector<uint32_t> ends;
+    ok = ok && reader.Read(SnapshotSection::STORE_NAME_TEXT, text) &&
+         reader.Read(SnapshotSection::STORE_NAME_ENDS, ends);
+    if (!ok) return false;
+
+    mNames.clear();
+    mNameLookup.clear();
+    uint32_t begin = 0;
+    for (uint32_t end : ends) {
+        if (end < begin || end > text.size()) ok = false;
+        if (!ok) break;
+        InternName(std::string(text.data() + begin, end - begin));
+        begin = end;
+    }
+
+    // 🔍 Colonnes de même longueur, poignées et noms cohérents
+    const size_t count = Size();
+    ok = ok && position.size() == count && previousPosition.size() == count && velocity.size() == count &&
+         energy.size() == count && maxEnergy.size() == count && age.size() == count && maxAge.size() == count &&
+         alive.size() == count && color.size() == count && size.size() == count && nameIndex.size() == count &&
+         lineage.size() == count && id.size() == count && slot.size() == count && ageMark.size() == count &&
+         growthMark.size() == count;
+    // Une tombe (morte, emplacement rendu) garde sa ligne jusqu'à la prochaine compaction
+    for (size_t i = 0; ok && i < count; ++i) {
+        ok = slot[i] < mSlots.size() && (mSlots[slot[i]].index == i || !alive[i]) && id[i] < mNextId &&
+             (nameIndex[i] == 0 || nameIndex[i] < mNames.size()) &&
+             static_cast<size_t>(type[i]) < SPECIES_COUNT;
+    }
+    for (size_t i = 0; ok && i < mFreeSlots.size(); ++i) {
+        ok = mFreeSlots[i] < mSlots.size() && mSlots[mFreeSlots[i]].index == UINT32_MAX;
+    }
+    if (!ok) {
+        std::cerr << "❌ Instantané incohérent : colonnes d'entités invalides" << std::endl;
+        return false;
+    }
+    dormant.assign(count, 0);  // Rétabli par l'échéancier des plantes
+    asleep.assign(count, 0);   // Tout le monde se réveille au chargement
+    mTombstones = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!IsTombstone(i)) continue;
+        dormant[i] = 1;
+        ++mTombstones;
+    }
+    return true;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,360 @@
+#include "Core/EventTrace.h"
+#include <cstring>
+#include <iostream>
+
+namespace Ecosystem {
+namespace Core {
+
+namespace {
+
+const char TRACE_MAGIC[8] = {'E', 'C', 'O', 'T', 'R', 'C', '1', '\0'};
+const size_t HEADER_SIZE = 24;  // magic, version, intervalle des keyframes, graine
+
+// Marqueurs de bloc
+const unsigned char CHUNK_TICK = 1;
+const unsigned char CHUNK_KEYFRAME = 2;
+const unsigned char TICK_HAS_DELTA_TIME = 1;
+
+// 🔢 ENCODAGES : varint (7 bits par octet) et zigzag pour les deltas signés
+void PutVarint(std::vector<unsigned char>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(value));
+}
+
+void PutSigned(std::vector<unsigned char>& out, int64_t value) {
+    PutVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+void PutFloat(std::vector<unsigned char>& out, float value) {
+    unsigned char bytes[4];
+    std::memcpy(bytes, &value, 4);
+    out.insert(out.end(), bytes, bytes + 4);
+}
+
+// Lecture bornée dans un bloc décodé en mémoire
+struct Cursor {
+    const unsigned char* data;
+    const unsigned char* end;
+    bool ok = true;
+
+    uint64_t Varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (data == end) break;
+            const unsigned char byte = *data++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) return value;
+        }
+        ok = false;
+        return 0;
+    }
+    int64_t Signed() {
+        const uint64_t value = Varint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+    float Float() {
+        float value = 0.0f;
+        if (end - data < 4) {
+            ok = false;
+            return value;
+        }
+        std::memcpy(&value, data, 4);
+        data += 4;
+        return value;
+    }
+    unsigned char Byte() {
+        if (data == end) {
+            ok = false;
+            return 0;
+        }
+        return *data++;
+    }
+};
+
+// Varint lu directement dans le fichier ; false en fin de fichier
+bool ReadVarint(std::istream& in, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        const int byte = in.get();
+        if (byte == EOF) return false;
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+// 🏗 ENREGISTREUR
+TraceRecorder::TraceRecorder()
+    : mKeyframeInterval(1), mEventCount(0), mPreviousTick(0), mPreviousEntity(0),
+      mPreviousDeltaTime(0.0f), mDeltaTimeKnown(false), mBytesWritten(0) {}
+
+TraceRecorder::~TraceRecorder() {
+    Close();
+}
+
+bool TraceRecorder::Open(const std::string& path, uint64_t seed, uint32_t keyframeInterval) {
+    Close();
+    mFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!mFile) {
+        std::cerr << "❌ Impossible de créer la trace: " << path << std::endl;
+        return false;
+    }
+    mPath = path;
+    mKeyframeInterval = keyframeInterval > 0 ? keyframeInterval : 1;
+    mBlock.clear();
+    mEventCount = 0;
+    mBytesWritten = 0;
+
+    unsigned char header[HEADER_SIZE];
+    std::memcpy(header, TRACE_MAGIC, 8);
+    const uint32_t version = TRACE_VERSION;
+    std::memcpy(header + 8, &version, 4);
+    std::memcpy(header + 12, &mKeyframeInterval, 4);
+    std::memcpy(header + 16, &seed, 8);
+    Write(header, sizeof(header));
+    return true;
+}
+
+void TraceRecorder::Close() {
+    if (mFile.is_open()) mFile.close();
+}
+
+void TraceRecorder::Write(const unsigned char* data, size_t length) {
+    mFile.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(length));
+    mBytesWritten += length;
+}
+
+// ✍️ ÉVÉNEMENTS : type et détail sur un octet, identifiant en delta du précédent
+void TraceRecorder::BeginRecord(TraceEvent event, uint8_t detail, uint32_t entity) {
+    mBlock.push_back(static_cast<unsigned char>(static_cast<uint8_t>(event) | (detail << 4)));
+    PutSigned(mBlock, static_cast<int64_t>(entity) - static_cast<int64_t>(mPreviousEntity));
+    mPreviousEntity = entity;
+    ++mEventCount;
+}
+
+void TraceRecorder::RecordSpawn(EntityId entity, EntityType type, Vector2D position) {
+    BeginRecord(TraceEvent::SPAWN, static_cast<uint8_t>(type), entity);
+    PutFloat(mBlock, position.x);
+    PutFloat(mBlock, position.y);
+}
+
+void TraceRecorder::RecordBirth(EntityId parent, EntityId child) {
+    BeginRecord(TraceEvent::BIRTH, 0, child);
+    PutSigned(mBlock, static_cast<int64_t>(child) - static_cast<int64_t>(parent));
+}
+
+void TraceRecorder::RecordDeath(EntityId entity, DeathCause cause, int age) {
+    BeginRecord(TraceEvent::DEATH, static_cast<uint8_t>(cause), entity);
+    PutVarint(mBlock, static_cast<uint32_t>(age));
+}
+
+void TraceRecorder::RecordEat(EntityId entity, float energy) {
+    BeginRecord(TraceEvent::EAT, 0, entity);
+    PutFloat(mBlock, energy);
+}
+
+void TraceRecorder::RecordFoodSpawn(Vector2D position, float energy) {
+    BeginRecord(TraceEvent::FOOD_SPAWN, 0, mPreviousEntity);
+    PutFloat(mBlock, position.x);
+    PutFloat(mBlock, position.y);
+    PutFloat(mBlock, energy);
+}
+
+void TraceRecorder::RecordInput(TraceEvent input, uint32_t a, uint32_t b, uint32_t c) {
+    mBlock.push_back(static_cast<unsigned char>(input));
+    PutVarint(mBlock, a);
+    if (input == TraceEvent::INPUT_RESET) {
+        PutVarint(mBlock, b);
+        PutVarint(mBlock, c);
+    }
+    ++mEventCount;
+}
+
+// 📦 BLOC DU TICK : delta de tick, pas de temps s'il a changé, nombre d'événements, taille
+void TraceRecorder::EndTick(uint32_t tick, float deltaTime) {
+    std::vector<unsigned char> prefix;
+    prefix.push_back(CHUNK_TICK);
+    PutVarint(prefix, tick - mPreviousTick);
+    const bool deltaTimeChanged = !mDeltaTimeKnown || deltaTime != mPreviousDeltaTime;
+    prefix.push_back(deltaTimeChanged ? TICK_HAS_DELTA_TIME : 0);
+    if (deltaTimeChanged) PutFloat(prefix, deltaTime);
+    PutVarint(prefix, mEventCount);
+    PutVarint(prefix, mBlock.size());
+    Write(prefix.data(), prefix.size());
+    Write(mBlock.data(), mBlock.size());
+
+    mPreviousTick = tick;
+    mPreviousDeltaTime = deltaTime;
+    mDeltaTimeKnown = true;
+    mPreviousEntity = 0;
+    mEventCount = 0;
+    mBlock.clear();
+}
+
+// 🔑 MARQUEUR DE KEYFRAME : le décodage peut reprendre ici sans l'historique
+void TraceRecorder::RecordKeyframe(uint32_t tick) {
+    std::vector<unsigned char> chunk;
+    chunk.push_back(CHUNK_KEYFRAME);
+    PutVarint(chunk, tick);
+    Write(chunk.data(), chunk.size());
+    mFile.flush();  // La trace reste lisible jusqu'à cette keyframe si le programme s'arrête
+    mPreviousTick = tick;
+    mDeltaTimeKnown = false;
+}
+
+std::string TraceRecorder::KeyframePath(const std::string& tracePath, uint32_t tick) {
+    return tracePath + "." + std::to_string(tick) + ".snap";
+}
+
+// 📖 LECTEUR
+TraceReader::TraceReader() : mSeed(0), mKeyframeInterval(1), mPreviousTick(0), mDeltaTime(0.0f) {}
+
+bool TraceReader::Open(const std::string& path) {
+    mFile.close();
+    mFile.clear();
+    mFile.open(path, std::ios::binary);
+    unsigned char header[HEADER_SIZE];
+    if (!mFile || !mFile.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+        std::memcmp(header, TRACE_MAGIC, 8) != 0) {
+        std::cerr << "❌ Trace invalide ou illisible: " << path << std::endl;
+        return false;
+    }
+    uint32_t version = 0;
+    std::memcpy(&version, header + 8, 4);
+    if (version != TRACE_VERSION) {
+        std::cerr << "❌ Version de trace non prise en charge (" << version << "): " << path << std::endl;
+        return false;
+    }
+    std::memcpy(&mKeyframeInterval, header + 12, 4);
+    std::memcpy(&mSeed, header + 16, 8);
+    mPath = path;
+
+    // 🔍 Index des keyframes : les blocs de tick sont sautés sans être décodés
+    mKeyframes.clear();
+    for (;;) {
+        const uint64_t offset = static_cast<uint64_t>(mFile.tellg());
+        const int tag = mFile.get();
+        if (tag == EOF) break;
+        uint64_t value = 0;
+        if (tag == CHUNK_KEYFRAME) {
+            if (!ReadVarint(mFile, value)) break;
+            mKeyframes.push_back({static_cast<uint32_t>(value), offset});
+            continue;
+        }
+        if (tag != CHUNK_TICK || !ReadVarint(mFile, value)) break;
+        const int flags = mFile.get();
+        if (flags == EOF) break;
+        if (flags & TICK_HAS_DELTA_TIME) mFile.ignore(4);
+        uint64_t count = 0;
+        uint64_t length = 0;
+        if (!ReadVarint(mFile, count) || !ReadVarint(mFile, length)) break;
+        mFile.ignore(static_cast<std::streamsize>(length));
+    }
+    mFile.clear();
+    return true;
+}
+
+bool TraceReader::SeekToKeyframe(uint32_t tick, uint32_t& keyframeTick) {
+    const Keyframe* best = nullptr;
+    for (const Keyframe& keyframe : mKeyframes) {
+        if (keyframe.tick <= tick && (!best || keyframe.tick >= best->tick)) best = &keyframe;
+    }
+    if (!best) return false;
+    mFile.clear();
+    mFile.seekg(static_cast<std::streamoff>(best->offset));
+    keyframeTick = best->tick;
+    return true;
+}
+
+bool TraceReader::Next(TraceTick& out) {
+    for (;;) {
+        const int tag = mFile.get();
+        if (tag == EOF) return false;
+        uint64_t value = 0;
+        if (tag == CHUNK_KEYFRAME) {
+            if (!ReadVarint(mFile, value)) return false;
+            mPreviousTick = static_cast<uint32_t>(value);
+            continue;
+        }
+        uint64_t count = 0;
+        uint64_t length = 0;
+        int flags = EOF;
+        if (tag != CHUNK_TICK || !ReadVarint(mFile, value) || (flags = mFile.get()) == EOF) {
+            std::cerr << "❌ Trace tronquée: " << mPath << std::endl;
+            return false;
+        }
+        if (flags & TICK_HAS_DELTA_TIME) mFile.read(reinterpret_cast<char*>(&mDeltaTime), 4);
+        mBlock.resize(0);
+        if (!ReadVarint(mFile, count) || !ReadVarint(mFile, length)) {
+            std::cerr << "❌ Trace tronquée: " << mPath << std::endl;
+            return false;
+        }
+        mBlock.resize(static_cast<size_t>(length));
+        if (!mFile.read(reinterpret_cast<char*>(mBlock.data()), static_cast<std::streamsize>(length))) {
+            // Bloc interrompu par un arrêt brutal : la trace s'arrête au tick précédent
+            return false;
+        }
+
+        mPreviousTick += static_cast<uint32_t>(value);
+        out.tick = mPreviousTick;
+        out.deltaTime = mDeltaTime;
+        out.records.clear();
+        Cursor cursor{mBlock.data(), mBlock.data() + mBlock.size()};
+        uint32_t previousEntity = 0;
+        for (uint64_t i = 0; i < count && cursor.ok; ++i) {
+            TraceRecord record{};
+            const unsigned char head = cursor.Byte();
+            record.event = static_cast<TraceEvent>(head & 0x0f);
+            record.detail = static_cast<uint8_t>(head >> 4);
+            if (record.event >= TraceEvent::INPUT_RESET) {
+                record.entity = static_cast<uint32_t>(cursor.Varint());
+                if (record.event == TraceEvent::INPUT_RESET) {
+                    record.other = static_cast<uint32_t>(cursor.Varint());
+                    record.extra = static_cast<uint32_t>(cursor.Varint());
+                }
+                out.records.push_back(record);
+                continue;
+            }
+            record.entity = static_cast<uint32_t>(previousEntity + cursor.Signed());
+            previousEntity = record.entity;
+            switch (record.event) {
+                case TraceEvent::SPAWN:
+                    record.x = cursor.Float();
+                    record.y = cursor.Float();
+                    break;
+                case TraceEvent::BIRTH:
+                    record.other = static_cast<uint32_t>(record.entity - cursor.Signed());
+                    break;
+                case TraceEvent::DEATH:
+                    record.other = static_cast<uint32_t>(cursor.Varint());
+                    break;
+                case TraceEvent::EAT:
+                    record.value = cursor.Float();
+                    break;
+                case TraceEvent::FOOD_SPAWN:
+                    record.x = cursor.Float();
+                    record.y = cursor.Float();
+                    record.value = cursor.Float();
+                    record.entity = 0;
+                    break;
+                default:
+                    cursor.ok = false;
+                    break;
+            }
+            out.records.push_back(record);
+        }
+        if (!cursor.ok) {
+            std::cerr << "❌ Bloc de trace invalide au tick " << out.tick << ": " << mPath << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
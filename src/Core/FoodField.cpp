@@ -0,0 +1,303 @@
+#include "Core/FoodField.h"
+#include "Core/Profiler.h"
+#include "Core/Random.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#if defined(ECO_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+namespace {
+
+// Cellules traitées par tranche parallèle (arrondi à des rangées entières)
+const size_t CELLS_PER_CHUNK = 8192;
+
+// Paramètres d'un pas, partagés par toutes les rangées
+struct StepParams {
+    float diffusion;
+    float regrowth;
+    float capacity;
+};
+
+// ➕ SOMME D'UNE RANGÉE : huit accumulateurs (la cellule i va dans acc[i % 8]),
+// combinés dans un ordre fixe. Les noyaux vectoriels gardent la même répartition,
+// le total est donc identique au bit près quel que soit le chemin.
+double CombineLanes(const float acc[8]) {
+    double total = 0.0;
+    for (int lane = 0; lane < 8; ++lane) total += acc[lane];
+    return total;
+}
+
+double SumRow(const float* row, size_t count) {
+    float acc[8] = {};
+    for (size_t i = 0; i < count; ++i) acc[i % 8] += row[i];
+    return CombineLanes(acc);
+}
+
+// 🧮 UNE CELLULE, FORMULE DE RÉFÉRENCE : laplacien à 5 points, puis repousse vers la capacité
+inline float StepCell(const float* cur, const float* up, const float* down, size_t i, const StepParams& p) {
+    const float v = cur[i];
+    const float laplacian = ((up[i] + down[i]) + (cur[i - 1] + cur[i + 1])) - 4.0f * v;
+    const float diffused = v + p.diffusion * laplacian;
+    return diffused + p.regrowth * (p.capacity - diffused);
+}
+
+double StepRowScalar(const float* cur, const float* up, const float* down, float* out,
+                     size_t count, const StepParams& p) {
+    float acc[8] = {};
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = StepCell(cur, up, down, i, p);
+        acc[i % 8] += out[i];
+    }
+    return CombineLanes(acc);
+}
+
+#if defined(ECO_SIMD_SSE2)
+// 4️⃣ QUATRE CELLULES PAR INSTRUCTION (deux registres par groupe de huit, pour les accumulateurs)
+inline __m128 StepSse2(const float* cur, const float* up, const float* down, size_t i,
+                       __m128 diffusion, __m128 regrowth, __m128 capacity) {
+    const __m128 v = _mm_loadu_ps(cur + i);
+    const __m128 vertical = _mm_add_ps(_mm_loadu_ps(up + i), _mm_loadu_ps(down + i));
+    const __m128 horizontal = _mm_add_ps(_mm_loadu_ps(cur + i - 1), _mm_loadu_ps(cur + i + 1));
+    const __m128 laplacian = _mm_sub_ps(_mm_add_ps(vertical, horizontal), _mm_mul_ps(_mm_set1_ps(4.0f), v));
+    const __m128 diffused = _mm_add_ps(v, _mm_mul_ps(diffusion, laplacian));
+    return _mm_add_ps(diffused, _mm_mul_ps(regrowth, _mm_sub_ps(capacity, diffused)));
+}
+
+double StepRowSse2(const float* cur, const float* up, const float* down, float* out,
+                   size_t count, const StepParams& p) {
+    const __m128 diffusion = _mm_set1_ps(p.diffusion);
+    const __m128 regrowth = _mm_set1_ps(p.regrowth);
+    const __m128 capacity = _mm_set1_ps(p.capacity);
+    __m128 accLow = _mm_setzero_ps();
+    __m128 accHigh = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128 low = StepSse2(cur, up, down, i, diffusion, regrowth, capacity);
+        const __m128 high = StepSse2(cur, up, down, i + 4, diffusion, regrowth, capacity);
+        _mm_storeu_ps(out + i, low);
+        _mm_storeu_ps(out + i + 4, high);
+        accLow = _mm_add_ps(accLow, low);
+        accHigh = _mm_add_ps(accHigh, high);
+    }
+    float acc[8];
+    _mm_storeu_ps(acc, accLow);
+    _mm_storeu_ps(acc + 4, accHigh);
+    for (; i < count; ++i) {
+        out[i] = StepCell(cur, up, down, i, p);
+        acc[i % 8] += out[i];
+    }
+    return CombineLanes(acc);
+}
+#endif
+
+#if defined(ECO_SIMD_AVX2)
+// 8️⃣ HUIT CELLULES PAR INSTRUCTION
+ECO_TARGET_AVX2 double StepRowAvx2(const float* cur, const float* up, const float* down, float* out,
+                                   size_t count, const StepParams& p) {
+    const __m256 diffusion = _mm256_set1_ps(p.diffusion);
+    const __m256 regrowth = _mm256_set1_ps(p.regrowth);
+    const __m256 capacity = _mm256_set1_ps(p.capacity);
+    const __m256 four = _mm256_set1_ps(4.0f);
+    __m256 accumulator = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256 v = _mm256_loadu_ps(cur + i);
+        const __m256 vertical = _mm256_add_ps(_mm256_loadu_ps(up + i), _mm256_loadu_ps(down + i));
+        const __m256 horizontal = _mm256_add_ps(_mm256_loadu_ps(cur + i - 1), _mm256_loadu_ps(cur + i + 1));
+        const __m256 laplacian = _mm256_sub_ps(_mm256_add_ps(vertical, horizontal), _mm256_mul_ps(four, v));
+        const __m256 diffused = _mm256_add_ps(v, _mm256_mul_ps(diffusion, laplacian));
+        const __m256 result = _mm256_add_ps(diffused, _mm256_mul_ps(regrowth, _mm256_sub_ps(capacity, diffused)));
+        _mm256_storeu_ps(out + i, result);
+        accumulator = _mm256_add_ps(accumulator, result);
+    }
+    float acc[8];
+    _mm256_storeu_ps(acc, accumulator);
+    for (; i < count; ++i) {
+        out[i] = StepCell(cur, up, down, i, p);
+        acc[i % 8] += out[i];
+    }
+    return CombineLanes(acc);
+}
+#endif
+
+} // namespace
+
+// 🏗 CONSTRUCTEUR
+FoodField::FoodField()
+    : mColumns(0), mRows(0), mStride(0), mCellSize(FOOD_FIELD_CELL_SIZE), mInvCellSize(1.0f / FOOD_FIELD_CELL_SIZE),
+      mCapacity(FOOD_FIELD_CAPACITY), mRegrowth(FOOD_FIELD_REGROWTH), mDiffusion(FOOD_FIELD_DIFFUSION), mTotal(0.0) {}
+
+// ⚙️ CONFIGURATION
+void FoodField::Configure(float worldWidth, float worldHeight, float cellSize, float capacity, float regrowth,
+                          float diffusion) {
+    FoodFieldShape shape;
+    shape.cellSize = cellSize > 0.0f ? cellSize : FOOD_FIELD_CELL_SIZE;
+    shape.columns = std::max(1, static_cast<int>(std::ceil(worldWidth / shape.cellSize)));
+    shape.rows = std::max(1, static_cast<int>(std::ceil(worldHeight / shape.cellSize)));
+    shape.capacity = capacity;
+    shape.regrowth = regrowth;
+    shape.diffusion = diffusion;
+    Configure(shape);
+}
+
+void FoodField::Configure(const FoodFieldShape& shape) {
+    mColumns = std::max(1, shape.columns);
+    mRows = std::max(1, shape.rows);
+    mStride = static_cast<size_t>(mColumns) + 2;
+    mCellSize = shape.cellSize;
+    mInvCellSize = 1.0f / mCellSize;
+    mCapacity = std::max(0.0f, shape.capacity);
+    mRegrowth = std::min(std::max(shape.regrowth, 0.0f), 1.0f);
+    // Au-delà de 1/4, la diffusion explicite n'est plus stable
+    mDiffusion = std::min(std::max(shape.diffusion, 0.0f), 0.25f);
+    mCells.assign((static_cast<size_t>(mRows) + 2) * mStride, 0.0f);
+    mNext.assign(mCells.size(), 0.0f);
+    mRowTotals.assign(static_cast<size_t>(mRows), 0.0);
+    mTotal = 0.0;
+}
+
+void FoodField::Disable() {
+    mColumns = 0;
+    mRows = 0;
+    mStride = 0;
+    mCells.clear();
+    mNext.clear();
+    mRowTotals.clear();
+    mTotal = 0.0;
+}
+
+void FoodField::Clear() {
+    std::fill(mCells.begin(), mCells.end(), 0.0f);
+    mTotal = 0.0;
+}
+
+FoodFieldShape FoodField::GetShape() const {
+    return {mColumns, mRows, mCellSize, mCapacity, mRegrowth, mDiffusion};
+}
+
+// 🎲 REMPLISSAGE ALÉATOIRE : une suite de tirages par rangée
+void FoodField::Fill(uint64_t seed, uint32_t tick) {
+    mTotal = 0.0;
+    for (int row = 0; row < mRows; ++row) {
+        float* cells = &mCells[static_cast<size_t>(row + 1) * mStride + 1];
+        FillUniformSequence(seed, static_cast<uint32_t>(row), tick, RandomPurpose::FOOD_FIELD,
+                            static_cast<size_t>(mColumns), cells);
+        for (int column = 0; column < mColumns; ++column) cells[column] *= mCapacity;
+        mTotal += SumRow(cells, static_cast<size_t>(mColumns));
+    }
+}
+
+// 🔄 PAS DE SIMULATION
+void FoodField::Step(TaskScheduler& scheduler) {
+    Step(scheduler, GetSimdPath());
+}
+
+void FoodField::Step(TaskScheduler& scheduler, SimdPath path) {
+    ECO_PROFILE_ZONE("FoodField::Step");
+    if (!IsActive()) return;
+    if (path == SimdPath::AUTO) path = GetSimdPath();
+    FillBorder();
+    // Chaque rangée n'écrit que dans mNext et sa propre somme : découpage sans effet sur le résultat
+    const size_t rowsPerChunk = std::max<size_t>(1, CELLS_PER_CHUNK / static_cast<size_t>(mColumns));
+    scheduler.ParallelFor(static_cast<size_t>(mRows), rowsPerChunk,
+        [this, path](size_t begin, size_t end, unsigned) { StepRows(begin, end, path); });
+    std::swap(mCells, mNext);
+    mTotal = 0.0;
+    for (double rowTotal : mRowTotals) mTotal += rowTotal;
+}
+
+void FoodField::StepRows(size_t begin, size_t end, SimdPath path) {
+    const StepParams params{mDiffusion, mRegrowth, mCapacity};
+    const size_t count = static_cast<size_t>(mColumns);
+    for (size_t row = begin; row < end; ++row) {
+        const size_t base = (row + 1) * mStride + 1;
+        const float* cur = &mCells[base];
+        float* out = &mNext[base];
+        switch (path) {
+#if defined(ECO_SIMD_AVX2)
+            case SimdPath::AVX2:
+                mRowTotals[row] = StepRowAvx2(cur, cur - mStride, cur + mStride, out, count, params);
+                continue;
+#endif
+#if defined(ECO_SIMD_SSE2)
+            case SimdPath::SSE2:
+                mRowTotals[row] = StepRowSse2(cur, cur - mStride, cur + mStride, out, count, params);
+                continue;
+#endif
+            default:
+                mRowTotals[row] = StepRowScalar(cur, cur - mStride, cur + mStride, out, count, params);
+                continue;
+        }
+    }
+}
+
+// 🧱 BORDURE : copie des cellules du bord (flux nul à travers les limites du monde)
+void FoodField::FillBorder() {
+    const size_t last = static_cast<size_t>(mRows);
+    std::copy_n(&mCells[mStride], mStride, &mCells[0]);
+    std::copy_n(&mCells[last * mStride], mStride, &mCells[(last + 1) * mStride]);
+    for (size_t row = 0; row < last + 2; ++row) {
+        float* cells = &mCells[row * mStride];
+        cells[0] = cells[1];
+        cells[mStride - 1] = cells[mStride - 2];
+    }
+}
+
+// 🍽 ACCÈS À UNE CELLULE
+size_t FoodField::CellOf(Vector2D position) const {
+    // Positions hors du monde ramenées dans les cellules du bord, en flottant avant le cast
+    // (fmax écarte aussi NaN : une vitesse aberrante ne doit pas donner un indice indéfini)
+    const int column = static_cast<int>(std::fmin(std::fmax(position.x * mInvCellSize, 0.0f), static_cast<float>(mColumns - 1)));
+    const int row = static_cast<int>(std::fmin(std::fmax(position.y * mInvCellSize, 0.0f), static_cast<float>(mRows - 1)));
+    return static_cast<size_t>(row + 1) * mStride + static_cast<size_t>(column) + 1;
+}
+
+float FoodField::Consume(Vector2D position, float amount) {
+    float& cell = mCells[CellOf(position)];
+    const float taken = std::min(cell, std::max(amount, 0.0f));
+    cell -= taken;
+    mTotal -= taken;
+    return taken;
+}
+
+void FoodField::Deposit(Vector2D position, float energy) {
+    mCells[CellOf(position)] += energy;
+    mTotal += energy;
+}
+
+Vector2D FoodField::Gradient(Vector2D position) const {
+    // Voisins lus dans la grille et non dans la bordure, qui n'est à jour qu'au début d'un pas
+    const size_t cell = CellOf(position);
+    const size_t column = (cell % mStride) - 1;
+    const size_t row = (cell / mStride) - 1;
+    const float west = mCells[column > 0 ? cell - 1 : cell];
+    const float east = mCells[column + 1 < static_cast<size_t>(mColumns) ? cell + 1 : cell];
+    const float north = mCells[row > 0 ? cell - mStride : cell];
+    const float south = mCells[row + 1 < static_cast<size_t>(mRows) ? cell + mStride : cell];
+    const float scale = 0.5f * mInvCellSize;
+    return Vector2D((east - west) * scale, (south - north) * scale);
+}
+
+// 💾 CELLULES BRUTES
+bool FoodField::SetCells(const std::vector<float>& cells) {
+    if (cells.size() != mCells.size()) {
+        std::cerr << "❌ Champ de nourriture incohérent : " << cells.size() << " cellules pour une grille de "
+                  << mCells.size() << std::endl;
+        return false;
+    }
+    mCells = cells;
+    mTotal = 0.0;
+    for (int row = 0; row < mRows; ++row) {
+        mTotal += SumRow(&mCells[static_cast<size_t>(row + 1) * mStride + 1], static_cast<size_t>(mColumns));
+    }
+    return true;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -1,51 +1,167 @@
 #include "Core/GameEngine.h" 
+#include "Core/Logger.h" 
+#include "Core/Profiler.h" 
+#include <algorithm> 
+#include <cmath> 
+#include <cstdio> 
 #include <iostream> 
 #include <sstream> 
 namespace Ecosystem { 
 namespace Core { 
+namespace { 
+const float MAX_ZOOM = 64.0f; 
+const float ZOOM_STEP = 1.25f;  // Par cran de molette ou appui sur +/- 
+} // namespace 
 // 🏗 CONSTRUCTEUR 
 GameEngine::GameEngine(const std::string& title, float width, float height) 
-    : mWindow(title, width, height),  
-      mEcosystem(width, height, 500), 
+    : GameEngine(title, [width, height] { 
+          SimulationConfig config; 
+          config.worldWidth = width; 
+          config.worldHeight = height; 
+          return config; 
+      }()) {} 
+GameEngine::GameEngine(const std::string& title, const SimulationConfig& config) 
+    : mConfig(config), 
+      mWindow(title, config.worldWidth, config.worldHeight),  
+      mEcosystem(config.worldWidth, config.worldHeight, config.maxEntities), 
       mIsRunning(false),  
       mIsPaused(false), 
       mTimeScale(1.0f), 
-      mAccumulatedTime(0.0f) {} 
+      mFramePending(true), 
+      mTimestep(config.fixedDeltaTime), 
+      mZoom(1.0f), 
+      mShowProfiler(false), 
+      mAverageRenderMs(0.0) {} 
+// 🗑 DESTRUCTEUR : le thread de simulation ne doit pas survivre au moteur 
+GameEngine::~GameEngine() { 
+    StopSimulation(); 
+} 
 // ⚙INITIALISATION 
 bool GameEngine::Initialize() { 
     if (!mWindow.Initialize()) { 
         return false; 
     }
-    mEcosystem.Initialize(20, 5, 30);  // 20 herbivores, 5 carnivores, 30 plantes 
+    if (mConfig.hasSeed) { 
+        mEcosystem.SetSeed(mConfig.seed); 
+    }
+    mEcosystem.SetThreadCount(mConfig.threadCount); 
+    mEcosystem.SetHistoryCapacity(static_cast<size_t>(mConfig.statsHistoryTicks)); 
+    if (mConfig.foodField) mEcosystem.EnableFoodField(mConfig.foodCellSize); 
+    mEcosystem.SetSleepingEnabled(mConfig.sleepingRegions); 
+    mEcosystem.SetLodThreshold(mConfig.lodThreshold); 
+    // 🔭 Vue initiale : le monde entier à l'échelle de la fenêtre 
+    mView.scale = std::min(mWindow.GetWidth() / mConfig.worldWidth, mWindow.GetHeight() / mConfig.worldHeight); 
+    mCaptureView = mView; 
+    // ⏱ Zones toujours mesurées en mode fenêtré : la répartition s'affiche avec P 
+    Profiler::SetEnabled(true); 
+    if (!mConfig.profilePath.empty()) Profiler::Instance().BeginCapture(); 
+    if (!mConfig.loadSnapshotPath.empty()) { 
+        // 📂 Reprise depuis un instantané 
+        if (!mEcosystem.LoadSnapshot(mConfig.loadSnapshotPath)) { 
+            return false; 
+        }
+    } else { 
+        // Par défaut : 20 herbivores, 5 carnivores, 30 plantes 
+        mEcosystem.Initialize(mConfig.initialHerbivores, mConfig.initialCarnivores, mConfig.initialPlants); 
+    }
+    if (!mConfig.tracePath.empty()) { 
+        if (!mTrace.Open(mConfig.tracePath, mEcosystem.GetSeed(), static_cast<uint32_t>(mConfig.keyframeInterval))) { 
+            return false; 
+        }
+        mEcosystem.SetTraceRecorder(&mTrace); 
+    }
     mIsRunning = true; 
-    mLastUpdateTime = std::chrono::high_resolution_clock::now(); 
-    std::cout << "✅Moteur de jeu initialisé" << std::endl; 
+    ECO_LOG(LogLevel::INFO, "✅Moteur de jeu initialisé"); 
     return true; 
 } 
-// BOUCLE PRINCIPALE 
+// BOUCLE PRINCIPALE : événements et rendu ici, simulation sur son thread 
 void GameEngine::Run() { 
-    std::cout << "🎯Démarrage de la boucle de jeu..." << std::endl; 
-    while (mIsRunning) 
-    { 
-        auto currentTime = std::chrono::high_resolution_clock::now(); 
-        std::chrono::duration<float> elapsed = currentTime - mLastUpdateTime; 
-        mLastUpdateTime = currentTime; 
-        float deltaTime = elapsed.count(); 
+    ECO_LOG(LogLevel::INFO, "🎯Démarrage de la boucle de jeu..."); 
+    // ⏱ Les zones sont agrégées par le thread de simulation : le rendu n'en enregistre pas 
+    Profiler::MuteThisThread(true); 
+    mSimulationThread = std::thread(&GameEngine::SimulationLoop, this); 
+    mLastRenderTime = std::chrono::steady_clock::now(); 
+    while (mIsRunning.load(std::memory_order_acquire)) { 
+        auto frameStart = std::chrono::steady_clock::now(); 
         HandleEvents(); 
-        if (!mIsPaused) { 
-            Update(deltaTime * mTimeScale); 
-            SDL_Delay(16);
+        // Dernière image publiée par la simulation (la précédente si aucune n'est arrivée) 
+        Render(mFrames.Acquire()); 
+        PaceFrame(frameStart); 
+    }
+    StopSimulation(); 
+    Profiler::MuteThisThread(false); 
+} 
+// 🧵 BOUCLE DE SIMULATION : pas fixes au rythme du temps réel, sans attendre l'affichage 
+void GameEngine::SimulationLoop() { 
+    // Attente maximale entre deux passages : les commandes restent prises en compte rapidement 
+    const float maxIdleSeconds = 0.005f; 
+    mLastUpdateTime = std::chrono::steady_clock::now(); 
+    mTimestep.Reset(); 
+    mFramePending = true;  // Première image : l'état initial 
+    while (mIsRunning.load(std::memory_order_acquire)) { 
+        { 
+            ECO_PROFILE_ZONE("GameEngine::Simulation"); 
+            // Entrées appliquées entre deux ticks, dans leur ordre d'arrivée 
+            SimulationCommand command; 
+            while (mCommands.Pop(command)) { 
+                ApplyCommand(command); 
+            }
+            auto now = std::chrono::steady_clock::now(); 
+            std::chrono::duration<float> elapsed = now - mLastUpdateTime; 
+            mLastUpdateTime = now; 
+            if (!mIsPaused) { 
+                // Zéro, un ou plusieurs pas fixes selon le temps accumulé 
+                int steps = mTimestep.Advance(elapsed.count() * mTimeScale); 
+                for (int i = 0; i < steps; ++i) { 
+                    Update(mTimestep.GetStep()); 
+                }
+                if (steps > 0) mFramePending = true; 
+            } 
         } 
-        Render(); 
-        
-    } 
+        // ⏱ Moyennes glissantes de l'itération (threads de travail au repos) 
+        Profiler::Instance().EndFrame(); 
+        // Image précédente pas encore affichée : inutile d'en copier une autre, on réessaiera 
+        if (mFramePending && !mFrames.HasUnread()) PublishFrame(); 
+        const float wait = mIsPaused ? maxIdleSeconds 
+                                     : std::min(mTimestep.GetTimeToNextStep() / mTimeScale, maxIdleSeconds); 
+        std::this_thread::sleep_for(std::chrono::duration<float>(wait)); 
+    }
+} 
+// 📸 PUBLICATION D'UNE IMAGE (thread de simulation, entre deux ticks) 
+void GameEngine::PublishFrame() { 
+    RenderFrame& frame = mFrames.GetBack(); 
+    mEcosystem.CaptureFrame(frame, mCaptureView); 
+    frame.alpha = mTimestep.GetAlpha(); 
+    frame.stepSeconds = mIsPaused ? 0.0 : mTimestep.GetStep() / mTimeScale; 
+    frame.capturedAt = std::chrono::steady_clock::now(); 
+    const Profiler& profiler = Profiler::Instance(); 
+    frame.zones = profiler.GetBreakdown(); 
+    frame.simulationFrameMs = profiler.GetAverageFrameMs(); 
+    mFrames.Publish(); 
+    mFramePending = false; 
+} 
+// ⏹ ARRÊT DU THREAD DE SIMULATION (sans effet s'il ne tourne pas) 
+void GameEngine::StopSimulation() { 
+    mIsRunning = false; 
+    if (mSimulationThread.joinable()) mSimulationThread.join(); 
+} 
+// 🕰 CADENCE D'AFFICHAGE : attend la fin de la frame cible au lieu d'un délai fixe 
+void GameEngine::PaceFrame(std::chrono::steady_clock::time_point frameStart) { 
+    if (mConfig.targetFrameRate <= 0) return; 
+    const auto frameDuration = std::chrono::nanoseconds(1000000000LL / mConfig.targetFrameRate); 
+    const auto spent = std::chrono::steady_clock::now() - frameStart; 
+    if (spent < frameDuration) { 
+        auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(frameDuration - spent); 
+        SDL_DelayNS(static_cast<uint64_t>(remaining.count())); 
     }
-        // Limitation à ~60 FPS 
-         
+} 
 // FERMETURE 
 void GameEngine::Shutdown() { 
-    mIsRunning = false; 
-    std::cout << "🔄Moteur de jeu arrêté" << std::endl; 
+    StopSimulation(); 
+    mDensityTexture.Release();  // Avant le renderer qui l'a créée 
+    if (!mConfig.profilePath.empty()) Profiler::Instance().EndCapture(mConfig.profilePath); 
+    if (!mConfig.statsHistoryPath.empty()) mEcosystem.GetHistory().WriteCsv(mConfig.statsHistoryPath); 
+    ECO_LOG(LogLevel::INFO, "🔄Moteur de jeu arrêté"); 
 } 
 // GESTION DES ÉVÉNEMENTS 
 void GameEngine::HandleEvents() { 
@@ -58,34 +174,128 @@ void GameEngine::HandleEvents() {
             case SDL_EVENT_KEY_DOWN: 
                 HandleInput(event.key.key); 
                 break; 
+            case SDL_EVENT_MOUSE_WHEEL: 
+                ZoomAt(std::pow(ZOOM_STEP, event.wheel.y), event.wheel.mouse_x, event.wheel.mouse_y); 
+                break; 
         } 
     }
  } 
-// ⌨GESTION DES TOUCHES 
+// ⌨GESTION DES TOUCHES : l'affichage réagit ici, la simulation reçoit une commande 
 void GameEngine::HandleInput(SDL_Keycode key) { 
+    SimulationCommandType type = SimulationCommandType::KEY; 
     switch (key) { 
         case SDLK_ESCAPE: 
             mIsRunning = false; 
             break; 
+        case SDLK_P: 
+            // ⏱ Répartition du temps d'image par zone 
+            mShowProfiler = !mShowProfiler; 
+            break; 
         case SDLK_SPACE: 
-            mIsPaused = !mIsPaused; 
-            std::cout << (mIsPaused ? "⏸Simulation en pause" : "▶Simulation reprend") <<std::endl; 
+            type = SimulationCommandType::TOGGLE_PAUSE; 
             break; 
         case SDLK_R: 
-            mEcosystem.Initialize(20, 5, 30); 
-            std::cout << "🔄Simulation réinitialisée" << std::endl; 
+            type = SimulationCommandType::RESET; 
+            break; 
+        case SDLK_S: 
+            type = SimulationCommandType::SAVE_SNAPSHOT; 
             break; 
         case SDLK_F: 
-            mEcosystem.SpawnFood(10); 
-            std::cout << "🍎Nourriture ajoutée" << std::endl; 
+            type = SimulationCommandType::SPAWN_FOOD; 
             break; 
         case SDLK_UP: 
-            mTimeScale *= 1.5f; 
-            std::cout << "⏩Vitesse: " << mTimeScale << "x" << std::endl; 
+            type = SimulationCommandType::SPEED_UP; 
             break; 
         case SDLK_DOWN: 
+            type = SimulationCommandType::SLOW_DOWN; 
+            break; 
+        case SDLK_EQUALS: 
+        case SDLK_KP_PLUS: 
+            ZoomAt(ZOOM_STEP, mWindow.GetWidth() * 0.5f, mWindow.GetHeight() * 0.5f); 
+            break; 
+        case SDLK_MINUS: 
+        case SDLK_KP_MINUS: 
+            ZoomAt(1.0f / ZOOM_STEP, mWindow.GetWidth() * 0.5f, mWindow.GetHeight() * 0.5f); 
+            break; 
+    }
+    // 🎞 Toutes les touches passent par la simulation, qui les trace entre deux ticks 
+    if (!mCommands.Push({type, static_cast<uint32_t>(key), {}, 0.0f})) { 
+        ECO_LOG(LogLevel::WARNING, "⚠File de commandes pleine : touche ignorée"); 
+    }
+ } 
+// 🔭 ZOOM DE LA CAMÉRA : le point visé reste sous le curseur, la vue reste dans le monde 
+void GameEngine::ZoomAt(float factor, float screenX, float screenY) { 
+    const float zoom = std::clamp(mZoom * factor, 1.0f, MAX_ZOOM); 
+    if (zoom == mZoom) return; 
+    const float baseScale = std::min(mWindow.GetWidth() / mConfig.worldWidth, mWindow.GetHeight() / mConfig.worldHeight); 
+    const float anchorX = mView.x + screenX / mView.scale; 
+    const float anchorY = mView.y + screenY / mView.scale; 
+    mZoom = zoom; 
+    mView.scale = baseScale * zoom; 
+    mView.width = mWindow.GetWidth() / mView.scale; 
+    mView.height = mWindow.GetHeight() / mView.scale; 
+    mView.x = std::clamp(anchorX - screenX / mView.scale, 0.0f, std::max(0.0f, mConfig.worldWidth - mView.width)); 
+    mView.y = std::clamp(anchorY - screenY / mView.scale, 0.0f, std::max(0.0f, mConfig.worldHeight - mView.height)); 
+    if (mZoom == 1.0f) {  // Retour au monde entier : plus de découpe 
+        mView.x = 0.0f; 
+        mView.y = 0.0f; 
+        mView.width = 0.0f; 
+        mView.height = 0.0f; 
+    }
+    // Les images déjà publiées restent dessinées avec la nouvelle vue jusqu'à la suivante 
+    SimulationCommand command = {SimulationCommandType::SET_VIEW, 0, {mView.x, mView.y, mView.width, mView.height}, 
+                                 mView.scale}; 
+    if (!mCommands.Push(command)) { 
+        ECO_LOG(LogLevel::WARNING, "⚠File de commandes pleine : vue ignorée"); 
+    }
+ } 
+// 🎮 APPLICATION D'UNE COMMANDE (thread de simulation, entre deux ticks) 
+void GameEngine::ApplyCommand(const SimulationCommand& command) { 
+    mFramePending = true; 
+    if (command.type == SimulationCommandType::SET_VIEW) { 
+        // 🔭 Affichage seulement : la simulation n'en dépend pas, rien n'est tracé 
+        mCaptureView.x = command.view[0]; 
+        mCaptureView.y = command.view[1]; 
+        mCaptureView.width = command.view[2]; 
+        mCaptureView.height = command.view[3]; 
+        mCaptureView.scale = command.viewScale; 
+        return; 
+    }
+    // 🎞 Toutes les touches sont tracées ; R et F le sont aussi comme commandes rejouables 
+    if (mTrace.IsOpen()) mTrace.RecordInput(TraceEvent::INPUT_KEY, command.key); 
+    switch (command.type) { 
+        case SimulationCommandType::KEY: 
+            break; 
+        case SimulationCommandType::TOGGLE_PAUSE: 
+            mIsPaused = !mIsPaused; 
+            ECO_LOG(LogLevel::INFO, (mIsPaused ? "⏸Simulation en pause" : "▶Simulation reprend")); 
+            break; 
+        case SimulationCommandType::RESET: 
+            if (mTrace.IsOpen()) { 
+                mTrace.RecordInput(TraceEvent::INPUT_RESET, mConfig.initialHerbivores, 
+                                   mConfig.initialCarnivores, mConfig.initialPlants); 
+            }
+            mEcosystem.Initialize(mConfig.initialHerbivores, mConfig.initialCarnivores, mConfig.initialPlants); 
+            ECO_LOG(LogLevel::INFO, "🔄Simulation réinitialisée"); 
+            break; 
+        case SimulationCommandType::SAVE_SNAPSHOT: 
+            // 💾 Instantané de l'état courant (entre deux ticks) 
+            mEcosystem.SaveSnapshot(mConfig.saveSnapshotPath.empty() ? "ecosystem.snap" : mConfig.saveSnapshotPath); 
+            break; 
+        case SimulationCommandType::SPAWN_FOOD: 
+            if (mTrace.IsOpen()) mTrace.RecordInput(TraceEvent::INPUT_SPAWN_FOOD, 10); 
+            mEcosystem.SpawnFood(10); 
+            ECO_LOG(LogLevel::INFO, "🍎Nourriture ajoutée"); 
+            break; 
+        case SimulationCommandType::SPEED_UP: 
+            mTimeScale *= 1.5f; 
+            ECO_LOG(LogLevel::INFO, "⏩Vitesse: " << mTimeScale << "x"); 
+            break; 
+        case SimulationCommandType::SLOW_DOWN: 
             mTimeScale /= 1.5f; 
-            std::cout << "⏪Vitesse: " << mTimeScale << "x" << std::endl; 
+            ECO_LOG(LogLevel::INFO, "⏪Vitesse: " << mTimeScale << "x"); 
+            break; 
+        case SimulationCommandType::SET_VIEW: 
             break; 
     }
  } 
@@ -97,27 +307,59 @@ void GameEngine::Update(float deltaTime) {
     statsTimer += deltaTime; 
     if (statsTimer >= 2.0f) { 
         auto stats = mEcosystem.GetStatistics(); 
-        std::cout << "📊Stats - Herbivores: " << stats.totalHerbivores  
+        ECO_LOG(LogLevel::INFO, "📊Stats - Herbivores: " << stats.totalHerbivores  
                   << ", Carnivores: " << stats.totalCarnivores 
                   << ", Plantes: " << stats.totalPlants 
                   << ", Naissances: " << stats.birthsToday 
-                  << ", Morts: " << stats.deathsToday << std::endl; 
+                  << ", Morts: " << stats.deathsToday); 
         statsTimer = 0.0f; 
     }
  } 
-// RENDU 
-void GameEngine::Render() { 
+// RENDU (thread principal) : seule l'image publiée est lue, jamais l'écosystème 
+void GameEngine::Render(const RenderFrame* frame) { 
+    const auto now = std::chrono::steady_clock::now(); 
+    const double intervalMs = std::chrono::duration<double, std::milli>(now - mLastRenderTime).count(); 
+    mLastRenderTime = now; 
+    mAverageRenderMs = mAverageRenderMs > 0.0 ? mAverageRenderMs * 0.95 + intervalMs * 0.05 : intervalMs; 
     mWindow.Clear(); 
-    // Rendu de l'écosystème 
-    mEcosystem.Render(mWindow.GetRenderer()); 
-    // Ici on ajouterait l'interface utilisateur 
-    RenderUI(); 
+    if (frame) { 
+        // Fond, carte de densité (seulement ses cellules modifiées sont envoyées), puis les 
+        // corps interpolés entre les deux derniers états, avancés depuis la capture 
+        SDL_Renderer* renderer = mWindow.GetRenderer(); 
+        mRenderBatch.Begin(); 
+        frame->DrawBackground(mRenderBatch, mView); 
+        mRenderBatch.Flush(renderer); 
+        mDensityTexture.Apply(renderer, *frame); 
+        mDensityTexture.Draw(renderer, *frame, mView); 
+        mRenderBatch.Begin(); 
+        frame->DrawEntities(mRenderBatch, frame->AlphaAt(now), mView); 
+        mRenderBatch.Flush(renderer); 
+        RenderUI(*frame); 
+    }
     mWindow.Present(); 
 } 
 // INTERFACE UTILISATEUR 
-void GameEngine::RenderUI() { 
-    // Pour l'instant, interface texte dans la console 
-    // Une vraie interface graphique serait implémentée ici 
+void GameEngine::RenderUI(const RenderFrame& frame) { 
+    if (!mShowProfiler) return; 
+    // ⏱ Répartition glissante du temps de simulation, copiée dans l'image publiée 
+    SDL_Renderer* renderer = mWindow.GetRenderer(); 
+    const float lineHeight = 10.0f; 
+    float y = 8.0f; 
+    char line[128]; 
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); 
+    std::snprintf(line, sizeof(line), "Image %.2f ms, simulation %.2f ms (%zu passages), tick %u", mAverageRenderMs, 
+                  frame.simulationFrameMs, static_cast<size_t>(Profiler::HISTORY_FRAMES), frame.tick); 
+    SDL_RenderDebugText(renderer, 8.0f, y, line); 
+    y += lineHeight; 
+    std::snprintf(line, sizeof(line), "Zoom %.2fx, %zu entites visibles, detail %.2f", mZoom, frame.visibleEntities, 
+                  frame.detail); 
+    SDL_RenderDebugText(renderer, 8.0f, y, line); 
+    for (const auto& zone : frame.zones) { 
+        if (zone.depth > 3) continue;  // Les tranches des travailleurs restent dans la trace Chrome 
+        y += lineHeight; 
+        std::snprintf(line, sizeof(line), "%*s%-32s %7.2f ms", zone.depth * 2, "", zone.name, zone.averageMs); 
+        SDL_RenderDebugText(renderer, 8.0f, y, line); 
+    }
 } 
 } // namespace Core 
 } // namespace Ecosystem
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "Core/HeadlessEngine.h"
+#include "Core/Logger.h"
+#include "Core/Profiler.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+HeadlessEngine::HeadlessEngine(const SimulationConfig& config)
+    : mConfig(config),
+      mEcosystem(config.worldWidth, config.worldHeight, config.maxEntities) {}
+
+// ⚙️ INITIALISATION
+bool HeadlessEngine::Initialize() {
+    mEcosystem.SetThreadCount(mConfig.threadCount);
+    mEcosystem.SetHistoryCapacity(static_cast<size_t>(mConfig.statsHistoryTicks));
+    if (mConfig.foodField) mEcosystem.EnableFoodField(mConfig.foodCellSize);
+    mEcosystem.SetSleepingEnabled(mConfig.sleepingRegions);
+    // ⏱ Sans --profile, les zones restent inactives
+    if (!mConfig.profilePath.empty()) {
+        Profiler::SetEnabled(true);
+        Profiler::Instance().BeginCapture();
+    }
+    if (!mConfig.replayPath.empty()) {
+        // 🎞 Reconstruction depuis la keyframe la plus proche
+        const auto start = std::chrono::steady_clock::now();
+        if (!mEcosystem.ReplayTo(mConfig.replayPath, static_cast<uint32_t>(mConfig.replayTick))) return false;
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        Logger::Instance().Flush();
+        std::cout << "🎞 Tick " << mConfig.replayTick << " reconstruit en " << seconds << " s, "
+                  << mEcosystem.GetThreadCount() << " thread(s)" << std::endl;
+        return true;
+    }
+    if (!mConfig.loadSnapshotPath.empty()) {
+        // 📂 Reprise : graine, monde et horloge viennent de l'instantané
+        if (!mEcosystem.LoadSnapshot(mConfig.loadSnapshotPath)) return false;
+        Logger::Instance().Flush();
+        std::cout << "🖥 Simulation sans fenêtre: " << mEcosystem.GetWorldWidth() << "x" << mEcosystem.GetWorldHeight()
+                  << ", reprise au tick " << mEcosystem.GetDayCycle() << ", " << mEcosystem.GetThreadCount()
+                  << " thread(s)" << std::endl;
+    } else {
+        const uint32_t seed = mConfig.hasSeed ? mConfig.seed : std::random_device{}();
+        mEcosystem.SetSeed(seed);
+        mEcosystem.Initialize(mConfig.initialHerbivores, mConfig.initialCarnivores, mConfig.initialPlants);
+        Logger::Instance().Flush();  // Le journal d'initialisation sort avant le résumé
+        std::cout << "🖥 Simulation sans fenêtre: " << mConfig.worldWidth << "x" << mConfig.worldHeight
+                  << ", graine " << seed << ", " << mEcosystem.GetThreadCount() << " thread(s), SIMD "
+                  << SimdPathName(GetSimdPath()) << std::endl;
+    }
+    // 🎞 Enregistrement à partir de l'état initial (première keyframe immédiate)
+    if (!mConfig.tracePath.empty()) {
+        if (!mTrace.Open(mConfig.tracePath, mEcosystem.GetSeed(), static_cast<uint32_t>(mConfig.keyframeInterval))) {
+            return false;
+        }
+        mEcosystem.SetTraceRecorder(&mTrace);
+    }
+    return true;
+}
+
+// 🔁 BOUCLE DE SIMULATION
+HeadlessEngine::RunReport HeadlessEngine::Run() {
+    using Clock = std::chrono::steady_clock;
+
+    RunReport report{0, 0.0, 0.0, 0.0};
+    long long entityUpdates = 0;
+    const auto start = Clock::now();
+    const bool hasBudget = mConfig.timeBudgetSeconds > 0.0;
+    const auto deadline = start + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(mConfig.timeBudgetSeconds));
+
+    while (mConfig.maxTicks == 0 || report.ticks < mConfig.maxTicks) {
+        entityUpdates += mEcosystem.GetEntityCount();
+        mEcosystem.Update(mConfig.fixedDeltaTime);
+        Profiler::Instance().EndFrame();
+        report.ticks++;
+
+        // L'horloge n'est consultée que tous les 64 ticks
+        if (hasBudget && (report.ticks & 63) == 0 && Clock::now() >= deadline) break;
+    }
+
+    report.elapsedSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    if (report.elapsedSeconds > 0.0) {
+        report.ticksPerSecond = report.ticks / report.elapsedSeconds;
+        report.entityUpdatesPerSecond = entityUpdates / report.elapsedSeconds;
+    }
+    return report;
+}
+
+// 📊 RAPPORT FINAL
+void HeadlessEngine::PrintReport(const RunReport& report) const {
+    Logger::Instance().Flush();
+    auto stats = mEcosystem.GetStatistics();
+    std::cout << "📊 Ticks: " << report.ticks
+              << " en " << report.elapsedSeconds << " s"
+              << " (" << report.ticksPerSecond << " ticks/s, "
+              << report.entityUpdatesPerSecond << " entités/s)" << std::endl;
+    std::cout << "📊 Final - Herbivores: " << stats.totalHerbivores
+              << ", Carnivores: " << stats.totalCarnivores
+              << ", Plantes: " << stats.totalPlants
+              << ", Nourriture: " << stats.totalFood
+              << ", Entités: " << mEcosystem.GetEntityCount() << std::endl;
+    std::cout << "🌱 Échéances de plantes en attente: " << mEcosystem.GetPlantSchedule().GetPendingCount() << std::endl;
+    const WorldRegions& regions = mEcosystem.GetRegions();
+    if (regions.IsEnabled()) {
+        std::cout << "💤 Régions endormies: " << regions.GetSleepingRegionCount() << "/" << regions.GetRegionCount()
+                  << ", entités endormies: " << regions.GetSleepingEntityCount() << std::endl;
+    }
+    std::cout << "🔑 Empreinte de l'état: " << std::hex << mEcosystem.ComputeChecksum() << std::dec << std::endl;
+}
+
+} // namespace Core
+} // namespace Ecosystem
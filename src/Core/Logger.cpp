@@ -0,0 +1,353 @@
+#include "Core/Logger.h"
+#include "Core/EventTrace.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace Ecosystem {
+namespace Core {
+
+std::atomic<uint8_t> Logger::sLevel{static_cast<uint8_t>(LogLevel::INFO)};
+std::atomic<bool> Logger::sBinaryEvents{false};
+
+namespace {
+
+// Anneau du thread courant, rendu au journal à la fin du thread
+struct RingHandle {
+    std::atomic<bool>* owned = nullptr;
+    void* ring = nullptr;
+    bool writing = false;  // Évite qu'un message imbriqué écrase celui en cours
+    ~RingHandle() {
+        if (owned) owned->store(false, std::memory_order_release);
+    }
+};
+thread_local RingHandle tRing;
+
+} // namespace
+
+// 🏗 CONSTRUCTEUR / INSTANCE UNIQUE
+Logger::Logger()
+    : mSequence(0), mDropped(0), mFlushRequested(0), mFlushCompleted(0), mStopping(false)
+{
+    mWriter = std::thread(&Logger::WriterLoop, this);
+}
+
+Logger& Logger::Instance() {
+    static Logger instance;
+    return instance;
+}
+
+// 🗑 DESTRUCTEUR : vide les anneaux avant de rendre la main
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mStopping = true;
+    }
+    mWakeCondition.notify_all();
+    mWriter.join();
+    const uint64_t dropped = mDropped.load(std::memory_order_relaxed);
+    if (dropped > 0) {
+        std::cerr << "⚠️ Journal: " << dropped << " message(s) perdu(s) (anneau plein)" << std::endl;
+    }
+}
+
+// 📂 FICHIER D'ÉVÉNEMENTS BINAIRES
+bool Logger::OpenEventFile(const std::string& path) {
+    Flush();
+    std::lock_guard<std::mutex> lock(mWakeMutex);
+    mEventFile.close();
+    mEventFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!mEventFile) {
+        std::cerr << "❌ Impossible d'ouvrir le journal d'événements: " << path << std::endl;
+        sBinaryEvents.store(false, std::memory_order_relaxed);
+        return false;
+    }
+    const char magic[8] = {'E', 'C', 'O', 'L', 'O', 'G', '1', '\0'};
+    mEventFile.write(magic, sizeof(magic));
+    sBinaryEvents.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+// 🧵 ANNEAU DU THREAD COURANT (enregistré au premier message, réutilisé après la fin du thread)
+Logger::ThreadRing& Logger::RingForThisThread() {
+    if (tRing.ring) return *static_cast<ThreadRing*>(tRing.ring);
+
+    std::lock_guard<std::mutex> lock(mRingsMutex);
+    ThreadRing* ring = nullptr;
+    for (auto& candidate : mRings) {
+        bool expected = false;
+        if (candidate->owned.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            ring = candidate.get();
+            break;
+        }
+    }
+    if (!ring) {
+        mRings.push_back(std::make_unique<ThreadRing>());
+        ring = mRings.back().get();
+        ring->owned.store(true, std::memory_order_release);
+    }
+    tRing.owned = &ring->owned;
+    tRing.ring = ring;
+    return *ring;
+}
+
+// ✍️ RÉSERVATION D'UN EMPLACEMENT
+Logger::Record* Logger::Reserve(LogLevel level) {
+    if (tRing.writing) return nullptr;
+    ThreadRing& ring = RingForThisThread();
+    const size_t head = ring.head.load(std::memory_order_relaxed);
+    if (head - ring.tail.load(std::memory_order_acquire) >= RING_CAPACITY) {
+        mDropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    Record& record = ring.records[head & (RING_CAPACITY - 1)];
+    record.sequence = mSequence.fetch_add(1, std::memory_order_relaxed);
+    record.level = level;
+    record.isEvent = false;
+    record.length = 0;
+    tRing.writing = true;
+    return &record;
+}
+
+// ✅ PUBLICATION (le thread d'écriture voit l'enregistrement complet)
+void Logger::Commit() {
+    ThreadRing& ring = *static_cast<ThreadRing*>(tRing.ring);
+    ring.head.store(ring.head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    tRing.writing = false;
+}
+
+// 🚿 VIDAGE SYNCHRONE
+void Logger::Flush() {
+    std::unique_lock<std::mutex> lock(mWakeMutex);
+    const uint64_t ticket = ++mFlushRequested;
+    mWakeCondition.notify_all();
+    mFlushedCondition.wait(lock, [&] { return mFlushCompleted >= ticket || mStopping; });
+}
+
+// 🔁 THREAD D'ÉCRITURE
+void Logger::WriterLoop() {
+    std::unique_lock<std::mutex> lock(mWakeMutex);
+    for (;;) {
+        const uint64_t flushTicket = mFlushRequested;
+        const bool stopping = mStopping;
+        lock.unlock();
+        while (Drain()) {}
+        lock.lock();
+
+        if (flushTicket > mFlushCompleted) {
+            mFlushCompleted = flushTicket;
+            mFlushedCondition.notify_all();
+        }
+        if (stopping) break;
+        // Réveil périodique : les messages sortent avec au plus quelques millisecondes de retard
+        mWakeCondition.wait_for(lock, std::chrono::milliseconds(5), [&] {
+            return mStopping || mFlushRequested > mFlushCompleted;
+        });
+    }
+}
+
+// 📤 Copie ce qui est publié dans tous les anneaux, trié par ordre d'émission ; false si rien
+bool Logger::Drain() {
+    mBatch.clear();
+    {
+        std::lock_guard<std::mutex> lock(mRingsMutex);
+        for (auto& ring : mRings) {
+            const size_t head = ring->head.load(std::memory_order_acquire);
+            size_t tail = ring->tail.load(std::memory_order_relaxed);
+            for (; tail != head; ++tail) {
+                mBatch.push_back(ring->records[tail & (RING_CAPACITY - 1)]);
+            }
+            ring->tail.store(tail, std::memory_order_release);
+        }
+    }
+    if (mBatch.empty()) return false;
+
+    std::sort(mBatch.begin(), mBatch.end(),
+              [](const Record& a, const Record& b) { return a.sequence < b.sequence; });
+    for (const Record& record : mBatch) {
+        Output(record);
+    }
+    std::cout.flush();
+    if (mEventFile.is_open()) mEventFile.flush();
+    return true;
+}
+
+void Logger::Output(const Record& record) {
+    if (!record.isEvent) {
+        std::cout.write(record.text, record.length);
+        std::cout.put('\n');
+        return;
+    }
+    // Enregistrement compact, champs juxtaposés sans remplissage
+    const LogEventRecord& event = record.event;
+    char bytes[28];
+    std::memcpy(bytes + 0, &event.sequence, 8);
+    std::memcpy(bytes + 8, &event.entity, 4);
+    bytes[12] = static_cast<char>(event.event);
+    bytes[13] = static_cast<char>(event.level);
+    bytes[14] = static_cast<char>(event.entityType);
+    bytes[15] = static_cast<char>(event.detail);
+    std::memcpy(bytes + 16, &event.x, 4);
+    std::memcpy(bytes + 20, &event.y, 4);
+    std::memcpy(bytes + 24, &event.value, 4);
+    mEventFile.write(bytes, sizeof(bytes));
+}
+
+// 🏷 NIVEAUX
+const char* Logger::LevelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::TRACE:   return "trace";
+        case LogLevel::DEBUG:   return "debug";
+        case LogLevel::INFO:    return "info";
+        case LogLevel::WARNING: return "warning";
+        case LogLevel::ERROR:   return "error";
+        case LogLevel::NONE:    return "none";
+    }
+    return "?";
+}
+
+bool Logger::ParseLevel(const std::string& name, LogLevel& out) {
+    for (int i = 0; i <= static_cast<int>(LogLevel::NONE); ++i) {
+        if (name == LevelName(static_cast<LogLevel>(i))) {
+            out = static_cast<LogLevel>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// 🧵 FORMATAGE D'UNE LIGNE (tronquée à MAX_MESSAGE_LENGTH)
+void LogLine::Append(const char* data, size_t length) {
+    if (!mRecord) return;
+    const size_t room = Logger::MAX_MESSAGE_LENGTH - mRecord->length;
+    const size_t count = std::min(room, length);
+    std::memcpy(mRecord->text + mRecord->length, data, count);
+    mRecord->length = static_cast<uint16_t>(mRecord->length + count);
+}
+
+LogLine& LogLine::operator<<(const char* text) {
+    Append(text, std::strlen(text));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(std::string_view text) {
+    Append(text.data(), text.size());
+    return *this;
+}
+
+LogLine& LogLine::operator<<(char value) {
+    Append(&value, 1);
+    return *this;
+}
+
+namespace {
+
+// Écriture décimale sans allocation ni locale
+template <typename Integer>
+size_t FormatInteger(char (&buffer)[24], Integer value) {
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    return static_cast<size_t>(result.ptr - buffer);
+}
+
+} // namespace
+
+LogLine& LogLine::operator<<(int value) {
+    char buffer[24];
+    Append(buffer, FormatInteger(buffer, value));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(long value) {
+    char buffer[24];
+    Append(buffer, FormatInteger(buffer, value));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(long long value) {
+    char buffer[24];
+    Append(buffer, FormatInteger(buffer, value));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(unsigned value) {
+    char buffer[24];
+    Append(buffer, FormatInteger(buffer, value));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(unsigned long value) {
+    char buffer[24];
+    Append(buffer, FormatInteger(buffer, value));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(unsigned long long value) {
+    char buffer[24];
+    Append(buffer, FormatInteger(buffer, value));
+    return *this;
+}
+
+// Même rendu que std::ostream par défaut (%g, 6 chiffres significatifs)
+LogLine& LogLine::operator<<(double value) {
+    char buffer[32];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%g", value);
+    if (length > 0) Append(buffer, std::min<size_t>(length, sizeof(buffer) - 1));
+    return *this;
+}
+
+// 🏷 ÉVÉNEMENTS D'ENTITÉ
+void LogEntityEvent(LogLevel level, LogEvent event, const EntityStore& store, size_t index, float value,
+                    uint8_t detail) {
+    if (Logger::IsBinaryEvents()) {
+        Logger& logger = Logger::Instance();
+        Logger::Record* record = logger.Reserve(level);
+        if (!record) return;
+        record->isEvent = true;
+        LogEventRecord& data = record->event;
+        data.sequence = record->sequence;
+        data.entity = store.id[index];
+        data.event = event;
+        data.level = level;
+        data.entityType = store.type[index];
+        data.detail = detail;
+        data.x = store.position[index].x;
+        data.y = store.position[index].y;
+        data.value = value;
+        logger.Commit();
+        return;
+    }
+
+    // Nom formaté sur la pile : aucune chaîne allouée par message
+    char nameBuffer[64];
+    const std::string_view name(nameBuffer, store.FormatName(index, nameBuffer, sizeof(nameBuffer)));
+    LogLine line(level);
+    switch (event) {
+        case LogEvent::ENTITY_SPAWNED:
+            line << "🌱 Entité créée: " << name
+                 << " à (" << store.position[index].x << ", " << store.position[index].y << ")";
+            break;
+        case LogEvent::ENTITY_BORN:
+            line << "👶 Copie d'entité créée: " << name;
+            break;
+        case LogEvent::ENTITY_ATE:
+            line << "🍽 " << name << " mange et gagne " << value << " énergie";
+            break;
+        case LogEvent::ENTITY_DIED:
+            line << "💀 " << name << " meurt - ";
+            switch (static_cast<DeathCause>(detail)) {
+                case DeathCause::STARVATION: line << "Faim"; break;
+                case DeathCause::OLD_AGE: line << "Vieillesse"; break;
+                case DeathCause::PREDATION: line << "Prédation"; break;
+            }
+            break;
+        case LogEvent::ENTITY_REMOVED:
+            line << "💀 Entité détruite: " << name << " (Âge: " << store.AgeOf(index) << ")";
+            break;
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
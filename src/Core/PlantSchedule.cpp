@@ -0,0 +1,51 @@
+#include "Core/PlantSchedule.h"
+#include "Core/Entity.h"
+
+namespace Ecosystem {
+namespace Core {
+
+// 📅 INSCRIPTION D'UNE PLANTE
+void PlantSchedule::Schedule(EntityStore& store, size_t index) {
+    const EntityHandle handle = store.GetHandle(index);
+    const int64_t mark = store.ageMark[index];
+    const int age = store.age[index];
+    // Mûre une fois l'âge REPRODUCTION_MIN_AGE dépassé (voir Entity::CanReproduce)
+    const int64_t maturity = mark + (REPRODUCTION_MIN_AGE + 1 - age);
+    store.dormant[index] = store.plantClocks.age < maturity ? 1 : 0;
+    if (store.dormant[index]) mMaturity.push({maturity, handle});
+    mDeaths.push({mark + (store.maxAge[index] - age), handle});
+}
+
+void PlantSchedule::Rebuild(EntityStore& store) {
+    Clear();
+    for (size_t i = 0; i < store.Size(); ++i) {
+        if (store.alive[i] && TraitsOf(store.type[i]).clocked) Schedule(store, i);
+    }
+}
+
+void PlantSchedule::Clear() {
+    mMaturity = Queue();
+    mDeaths = Queue();
+}
+
+// ⏰ ÉCHÉANCES DUES (les poignées périmées sont des plantes déjà retirées)
+void PlantSchedule::Advance(EntityStore& store, std::vector<size_t>& deaths, std::vector<size_t>& matured) {
+    const int64_t clock = store.plantClocks.age;
+    while (!mMaturity.empty() && mMaturity.top().due <= clock) {
+        const size_t index = store.IndexOf(mMaturity.top().handle);
+        mMaturity.pop();
+        if (index == SIZE_MAX) continue;
+        store.dormant[index] = 0;
+        matured.push_back(index);
+    }
+    while (!mDeaths.empty() && mDeaths.top().due <= clock) {
+        const size_t index = store.IndexOf(mDeaths.top().handle);
+        mDeaths.pop();
+        if (index == SIZE_MAX || !store.alive[index]) continue;
+        store.alive[index] = 0;
+        deaths.push_back(index);
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
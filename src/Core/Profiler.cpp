@@ -0,0 +1,205 @@
+#include "Core/Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace Ecosystem {
+namespace Core {
+
+std::atomic<bool> Profiler::sEnabled{false};
+thread_local bool Profiler::tMuted = false;
+
+namespace {
+
+const size_t INITIAL_RECORDS = 4096;
+
+// Tampon du thread courant, rendu au profileur à la fin du thread
+struct BufferHandle {
+    std::atomic<bool>* owned = nullptr;
+    Profiler::ThreadBuffer* buffer = nullptr;
+    ~BufferHandle() {
+        if (owned) owned->store(false, std::memory_order_release);
+    }
+};
+thread_local BufferHandle tBuffer;
+
+uint64_t SteadyNanoseconds() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+// 🏗 CONSTRUCTEUR / INSTANCE UNIQUE
+Profiler::Profiler()
+    : mOrigin(SteadyNanoseconds()), mCapturing(false), mCaptureTruncated(false), mCaptureLimit(0),
+      mFrameHistory{}, mFrameSum(0.0), mFrameCount(0), mLastFrameEnd(0)
+{
+}
+
+Profiler& Profiler::Instance() {
+    static Profiler instance;
+    return instance;
+}
+
+uint64_t Profiler::Now() const {
+    return SteadyNanoseconds() - mOrigin;
+}
+
+// 🧵 TAMPON DU THREAD COURANT (enregistré à la première zone, réutilisé après la fin du thread)
+Profiler::ThreadBuffer& Profiler::BufferForThisThread() {
+    if (tBuffer.buffer) return *tBuffer.buffer;
+
+    std::lock_guard<std::mutex> lock(mBuffersMutex);
+    ThreadBuffer* buffer = nullptr;
+    for (auto& candidate : mBuffers) {
+        bool expected = false;
+        if (candidate->owned.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            buffer = candidate.get();
+            break;
+        }
+    }
+    if (!buffer) {
+        mBuffers.push_back(std::make_unique<ThreadBuffer>());
+        buffer = mBuffers.back().get();
+        buffer->index = static_cast<uint32_t>(mBuffers.size() - 1);
+        buffer->records.reserve(INITIAL_RECORDS);
+        buffer->owned.store(true, std::memory_order_release);
+    }
+    tBuffer.owned = &buffer->owned;
+    tBuffer.buffer = buffer;
+    return *buffer;
+}
+
+// 🎞 CAPTURE
+void Profiler::BeginCapture(size_t maxEvents) {
+    std::lock_guard<std::mutex> lock(mBuffersMutex);
+    for (auto& buffer : mBuffers) {
+        buffer->records.clear();
+        buffer->aggregated = 0;
+    }
+    mCaptureLimit = maxEvents;
+    mCaptureTruncated = false;
+    mCapturing = true;
+}
+
+bool Profiler::EndCapture(const std::string& path) {
+    mCapturing = false;
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        std::cerr << "❌ Impossible d'écrire la trace de profilage: " << path << std::endl;
+        return false;
+    }
+
+    // 📝 Format trace_event : une zone complète ("ph":"X") par enregistrement, en microsecondes
+    size_t events = 0;
+    char line[256];
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    {
+        std::lock_guard<std::mutex> lock(mBuffersMutex);
+        bool first = true;
+        for (const auto& buffer : mBuffers) {
+            if (buffer->records.empty()) continue;
+            std::snprintf(line, sizeof(line),
+                          "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"thread %u\"}}",
+                          first ? "" : ",\n", buffer->index, buffer->index);
+            file << line;
+            first = false;
+            for (const Record& record : buffer->records) {
+                std::snprintf(line, sizeof(line),
+                              ",\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                              record.name, record.start / 1000.0, (record.end - record.start) / 1000.0,
+                              buffer->index);
+                file << line;
+            }
+            events += buffer->records.size();
+            buffer->records.clear();
+            buffer->aggregated = 0;
+        }
+    }
+    file << "\n]}\n";
+    file.flush();
+    if (!file) {
+        std::cerr << "❌ Écriture de la trace de profilage incomplète: " << path << std::endl;
+        return false;
+    }
+    if (mCaptureTruncated) {
+        std::cerr << "⚠️ Profilage: capture arrêtée à " << mCaptureLimit << " zones" << std::endl;
+    }
+    std::cout << "⏱ Trace de profilage écrite: " << path << " (" << events << " zones)" << std::endl;
+    return true;
+}
+
+// 🖼 FIN D'IMAGE
+void Profiler::EndFrame() {
+    if (!IsEnabled()) return;
+    AggregateFrame(BufferForThisThread());
+
+    std::lock_guard<std::mutex> lock(mBuffersMutex);
+    size_t retained = 0;
+    for (auto& buffer : mBuffers) {
+        if (!mCapturing) buffer->records.clear();
+        buffer->aggregated = buffer->records.size();
+        retained += buffer->records.size();
+    }
+    // Capture pleine : les zones suivantes ne sont plus conservées
+    if (mCapturing && retained >= mCaptureLimit) {
+        mCaptureTruncated = true;
+        mCapturing = false;
+    }
+}
+
+// 📊 MOYENNES GLISSANTES DES ZONES DU THREAD PRINCIPAL
+void Profiler::AggregateFrame(ThreadBuffer& main) {
+    const uint64_t now = Now();
+    const size_t slot = static_cast<size_t>(mFrameCount % HISTORY_FRAMES);
+
+    // Ordre de début : les zones parentes précèdent leurs enfants dans le tableau
+    auto first = main.records.begin() + static_cast<std::ptrdiff_t>(main.aggregated);
+    std::sort(first, main.records.end(),
+              [](const Record& a, const Record& b) { return a.start < b.start; });
+
+    for (ZoneSeries& series : mSeries) series.last = 0.0;
+    for (auto it = first; it != main.records.end(); ++it) {
+        ZoneSeries* series = nullptr;
+        for (ZoneSeries& candidate : mSeries) {
+            if (candidate.name == it->name || std::strcmp(candidate.name, it->name) == 0) {
+                series = &candidate;
+                break;
+            }
+        }
+        if (!series) {
+            mSeries.push_back({it->name, static_cast<int>(it->depth), {}, 0.0, 0.0});
+            series = &mSeries.back();
+        }
+        series->depth = std::min(series->depth, static_cast<int>(it->depth));
+        series->last += (it->end - it->start) / 1e6;
+    }
+
+    const size_t frames = static_cast<size_t>(std::min<uint64_t>(mFrameCount + 1, HISTORY_FRAMES));
+    mBreakdown.clear();
+    for (ZoneSeries& series : mSeries) {
+        series.sum += series.last - series.history[slot];
+        series.history[slot] = series.last;
+        mBreakdown.push_back({series.name, series.depth, series.last, series.sum / frames});
+    }
+
+    const double frameMs = mFrameCount > 0 ? (now - mLastFrameEnd) / 1e6 : 0.0;
+    mFrameSum += frameMs - mFrameHistory[slot];
+    mFrameHistory[slot] = frameMs;
+    mLastFrameEnd = now;
+    ++mFrameCount;
+}
+
+double Profiler::GetAverageFrameMs() const {
+    // La première image n'a pas de début mesuré
+    const uint64_t measured = mFrameCount > 0 ? mFrameCount - 1 : 0;
+    const size_t frames = static_cast<size_t>(std::min<uint64_t>(measured, HISTORY_FRAMES));
+    return frames > 0 ? mFrameSum / frames : 0.0;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,31 @@
+#include "Core/Random.h"
+
+namespace Ecosystem {
+namespace Core {
+
+// 📦 UN TIRAGE PAR ENTITÉ : le tirage n° draw est le mot draw % 4 du bloc draw / 4
+void FillUniform(uint64_t seed, uint32_t tick, RandomPurpose purpose,
+                 const uint32_t* ids, size_t count, float* out, uint32_t draw) {
+    const uint32_t purposeWord = static_cast<uint32_t>(purpose);
+    const uint32_t block = draw / 4;
+    const uint32_t lane = draw % 4;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = ToUnitFloat(Philox4x32(ids[i], tick, purposeWord, block, seed).v[lane]);
+    }
+}
+
+// 📦 SUITE DE TIRAGES D'UN MÊME FLUX (mêmes valeurs que RandomStream::NextFloat)
+void FillUniformSequence(uint64_t seed, uint32_t entity, uint32_t tick, RandomPurpose purpose,
+                         size_t count, float* out) {
+    const uint32_t purposeWord = static_cast<uint32_t>(purpose);
+    size_t i = 0;
+    for (uint32_t block = 0; i < count; ++block) {
+        const PhiloxBlock values = Philox4x32(entity, tick, purposeWord, block, seed);
+        for (int lane = 0; lane < 4 && i < count; ++lane, ++i) {
+            out[i] = ToUnitFloat(values.v[lane]);
+        }
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
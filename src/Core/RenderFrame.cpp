@@ -0,0 +1,68 @@
+#include "Core/RenderFrame.h"
+#include <algorithm>
+
+namespace Ecosystem {
+namespace Core {
+
+void RenderFrame::ClearEntities() {
+    previousPosition.clear();
+    position.clear();
+    size.clear();
+    color.clear();
+    energyBar.clear();
+}
+
+float RenderFrame::AlphaAt(std::chrono::steady_clock::time_point now) const {
+    if (stepSeconds <= 0.0) return alpha;
+    const double elapsed = std::chrono::duration<double>(now - capturedAt).count();
+    return static_cast<float>(std::clamp(alpha + elapsed / stepSeconds, 0.0, 1.0));
+}
+
+// 🎨 DESSIN DE L'IMAGE (coordonnées du monde ramenées à l'écran par la vue)
+void RenderFrame::DrawBackground(Graphics::BatchRenderer& batch, const RenderView& view) const {
+    batch.Reserve(batch.GetRectCount() + background.size());
+    for (const Rect& rect : background) {
+        batch.AddRect((rect.x - view.x) * view.scale, (rect.y - view.y) * view.scale,
+                      rect.width * view.scale, rect.height * view.scale, rect.color);
+    }
+}
+
+void RenderFrame::DrawEntities(Graphics::BatchRenderer& batch, float drawAlpha, const RenderView& view) const {
+    // Fondu vers la carte de densité : les corps s'estompent avec le détail
+    const float fade = std::clamp(detail, 0.0f, 1.0f);
+    Color energyColor(0, 255, 0, 255);
+    energyColor.a = static_cast<uint8_t>(energyColor.a * fade);
+    batch.Reserve(batch.GetRectCount() + position.size() * 2);
+    for (size_t i = 0; i < position.size(); ++i) {
+        // Interpolation entre le tick précédent et le tick courant
+        const Vector2D previous = previousPosition[i];
+        const Vector2D current = position[i];
+        const float side = size[i] * view.scale;
+        const float x = (previous.x + (current.x - previous.x) * drawAlpha - view.x) * view.scale - side / 2.0f;
+        const float y = (previous.y + (current.y - previous.y) * drawAlpha - view.y) * view.scale - side / 2.0f;
+        Color body = color[i];
+        body.a = static_cast<uint8_t>(body.a * fade);
+        batch.AddRect(x, y, side, side, body);
+        // 🔵 Indicateur d'énergie (barre de vie)
+        if (energyBar[i] >= 0.0f) batch.AddRect(x, y - 3.0f, side * energyBar[i], 2.0f, energyColor);
+    }
+}
+
+// 🔁 ÉCHANGES DU TRIPLE TAMPON
+void RenderFrameExchange::Publish() {
+    // release : les écritures de l'image sont visibles avant son indice
+    const uint8_t previous = mMiddle.exchange(static_cast<uint8_t>(mBack | FRESH), std::memory_order_acq_rel);
+    mBack = static_cast<uint8_t>(previous & ~FRESH);
+}
+
+const RenderFrame* RenderFrameExchange::Acquire() {
+    if (mMiddle.load(std::memory_order_acquire) & FRESH) {
+        const uint8_t previous = mMiddle.exchange(mFront, std::memory_order_acq_rel);
+        mFront = static_cast<uint8_t>(previous & ~FRESH);
+        mHasFrame = true;
+    }
+    return mHasFrame ? &mFrames[mFront] : nullptr;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,95 @@
+#include "Core/Simd.h"
+#include <atomic>
+#include <iostream>
+
+#if defined(ECO_SIMD_AVX2) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+namespace {
+
+std::atomic<uint8_t> sSimdPath{static_cast<uint8_t>(SimdPath::AUTO)};
+
+bool CpuHasAvx2() {
+#if defined(ECO_SIMD_AVX2) && (defined(__GNUC__) || defined(__clang__))
+    return __builtin_cpu_supports("avx2");
+#elif defined(ECO_SIMD_AVX2) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6;
+    if (!osSavesYmm || (info[2] & (1 << 28)) == 0) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return false;
+#endif
+}
+
+bool IsSupported(SimdPath path) {
+    switch (path) {
+        case SimdPath::AUTO:
+        case SimdPath::SCALAR:
+            return true;
+        case SimdPath::SSE2:
+#if defined(ECO_SIMD_SSE2)
+            return true;
+#else
+            return false;
+#endif
+        case SimdPath::AVX2:
+            return CpuHasAvx2();
+    }
+    return false;
+}
+
+} // namespace
+
+// 🏷 NOMS ET SÉLECTION DU CHEMIN
+bool ParseSimdPath(const std::string& text, SimdPath& out) {
+    if (text == "auto") out = SimdPath::AUTO;
+    else if (text == "scalar") out = SimdPath::SCALAR;
+    else if (text == "sse2") out = SimdPath::SSE2;
+    else if (text == "avx2") out = SimdPath::AVX2;
+    else return false;
+    return true;
+}
+
+const char* SimdPathName(SimdPath path) {
+    switch (path) {
+        case SimdPath::AUTO: return "auto";
+        case SimdPath::SCALAR: return "scalar";
+        case SimdPath::SSE2: return "sse2";
+        case SimdPath::AVX2: return "avx2";
+    }
+    return "?";
+}
+
+SimdPath DetectSimdPath() {
+    if (IsSupported(SimdPath::AVX2)) return SimdPath::AVX2;
+    if (IsSupported(SimdPath::SSE2)) return SimdPath::SSE2;
+    return SimdPath::SCALAR;
+}
+
+bool SetSimdPath(SimdPath path) {
+    if (!IsSupported(path)) {
+        std::cerr << "❌ Jeu d'instructions non pris en charge par ce processeur: " << SimdPathName(path) << std::endl;
+        return false;
+    }
+    sSimdPath.store(static_cast<uint8_t>(path == SimdPath::AUTO ? DetectSimdPath() : path), std::memory_order_relaxed);
+    return true;
+}
+
+SimdPath GetSimdPath() {
+    SimdPath path = static_cast<SimdPath>(sSimdPath.load(std::memory_order_relaxed));
+    if (path == SimdPath::AUTO) {
+        path = DetectSimdPath();
+        sSimdPath.store(static_cast<uint8_t>(path), std::memory_order_relaxed);
+    }
+    return path;
+}
+
+} // namespace Core
+} // namespace Ecosystem
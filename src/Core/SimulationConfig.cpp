@@ -0,0 +1,227 @@
+#include "Core/SimulationConfig.h"
+#include <cstdlib>
+#include <iostream>
+
+namespace Ecosystem {
+namespace Core {
+
+namespace {
+
+// Lecture de la valeur qui suit un drapeau ; false si absente ou mal formée
+bool ReadFloat(int argc, char* argv[], int& i, float& out) {
+    if (i + 1 >= argc) return false;
+    char* end = nullptr;
+    float value = std::strtof(argv[++i], &end);
+    if (end == argv[i] || *end != '\0') return false;
+    out = value;
+    return true;
+}
+
+bool ReadDouble(int argc, char* argv[], int& i, double& out) {
+    if (i + 1 >= argc) return false;
+    char* end = nullptr;
+    double value = std::strtod(argv[++i], &end);
+    if (end == argv[i] || *end != '\0') return false;
+    out = value;
+    return true;
+}
+
+bool ReadInteger(int argc, char* argv[], int& i, long long& out) {
+    if (i + 1 >= argc) return false;
+    char* end = nullptr;
+    long long value = std::strtoll(argv[++i], &end, 10);
+    if (end == argv[i] || *end != '\0' || value < 0) return false;
+    out = value;
+    return true;
+}
+
+bool ReadInt(int argc, char* argv[], int& i, int& out) {
+    long long value = 0;
+    if (!ReadInteger(argc, argv, i, value) || value > 0x7fffffff) return false;
+    out = static_cast<int>(value);
+    return true;
+}
+
+// Découpage "CxR" : colonnes et lignes de tuiles, 256 rangs au plus
+bool ParseTiles(const char* text, int& columns, int& rows) {
+    char* end = nullptr;
+    const long parsedColumns = std::strtol(text, &end, 10);
+    if (end == text || (*end != 'x' && *end != 'X')) return false;
+    const char* rowText = end + 1;
+    const long parsedRows = std::strtol(rowText, &end, 10);
+    if (end == rowText || *end != '\0') return false;
+    if (parsedColumns < 1 || parsedRows < 1 || parsedColumns * parsedRows > 256) return false;
+    columns = static_cast<int>(parsedColumns);
+    rows = static_cast<int>(parsedRows);
+    return true;
+}
+
+} // namespace
+
+// 🧾 ANALYSE DE LA LIGNE DE COMMANDE
+bool ParseCommandLine(int argc, char* argv[], SimulationConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string flag = argv[i];
+        bool ok = true;
+
+        if (flag == "--help" || flag == "-h") {
+            config.showHelp = true;
+        } else if (flag == "--headless") {
+            config.headless = true;
+        } else if (flag == "--verbose") {
+            config.verbose = true;
+        } else if (flag == "--log-level") {
+            ok = i + 1 < argc && Logger::ParseLevel(argv[++i], config.logLevel);
+            config.hasLogLevel = ok;
+        } else if (flag == "--log-events") {
+            ok = i + 1 < argc;
+            if (ok) config.eventLogPath = argv[++i];
+        } else if (flag == "--load-snapshot") {
+            ok = i + 1 < argc;
+            if (ok) config.loadSnapshotPath = argv[++i];
+        } else if (flag == "--save-snapshot") {
+            ok = i + 1 < argc;
+            if (ok) config.saveSnapshotPath = argv[++i];
+        } else if (flag == "--trace") {
+            ok = i + 1 < argc;
+            if (ok) config.tracePath = argv[++i];
+        } else if (flag == "--simd") {
+            ok = i + 1 < argc && ParseSimdPath(argv[++i], config.simdPath);
+        } else if (flag == "--stats-csv") {
+            ok = i + 1 < argc;
+            if (ok) config.statsHistoryPath = argv[++i];
+        } else if (flag == "--stats-history") {
+            ok = ReadInt(argc, argv, i, config.statsHistoryTicks) && config.statsHistoryTicks > 0;
+        } else if (flag == "--profile") {
+            ok = i + 1 < argc;
+            if (ok) config.profilePath = argv[++i];
+        } else if (flag == "--keyframe-interval") {
+            ok = ReadInt(argc, argv, i, config.keyframeInterval) && config.keyframeInterval > 0;
+        } else if (flag == "--replay") {
+            ok = i + 1 < argc;
+            if (ok) config.replayPath = argv[++i];
+            config.headless = true;
+        } else if (flag == "--replay-tick") {
+            ok = ReadInteger(argc, argv, i, config.replayTick) && config.replayTick <= 0xffffffffLL;
+        } else if (flag == "--ensemble") {
+            ok = i + 1 < argc;
+            if (ok) config.ensemblePath = argv[++i];
+        } else if (flag == "--ensemble-out") {
+            ok = i + 1 < argc;
+            if (ok) config.ensembleOutputPath = argv[++i];
+        } else if (flag == "--tiles") {
+            ok = i + 1 < argc && ParseTiles(argv[++i], config.tileColumns, config.tileRows);
+            config.headless = true;
+        } else if (flag == "--tile-buffer") {
+            ok = ReadInt(argc, argv, i, config.tileBufferMegabytes) && config.tileBufferMegabytes > 0 &&
+                 config.tileBufferMegabytes <= 4096;
+        } else if (flag == "--tile-check") {
+            config.tileCheck = true;
+        } else if (flag == "--width") {
+            ok = ReadFloat(argc, argv, i, config.worldWidth) && config.worldWidth > 0.0f;
+        } else if (flag == "--height") {
+            ok = ReadFloat(argc, argv, i, config.worldHeight) && config.worldHeight > 0.0f;
+        } else if (flag == "--herbivores") {
+            ok = ReadInt(argc, argv, i, config.initialHerbivores);
+        } else if (flag == "--carnivores") {
+            ok = ReadInt(argc, argv, i, config.initialCarnivores);
+        } else if (flag == "--plants") {
+            ok = ReadInt(argc, argv, i, config.initialPlants);
+        } else if (flag == "--max-entities") {
+            ok = ReadInt(argc, argv, i, config.maxEntities);
+        } else if (flag == "--food-field") {
+            config.foodField = true;
+        } else if (flag == "--food-cell") {
+            ok = ReadFloat(argc, argv, i, config.foodCellSize) && config.foodCellSize > 0.0f;
+        } else if (flag == "--no-sleep") {
+            config.sleepingRegions = false;
+        } else if (flag == "--seed") {
+            long long seed = 0;
+            ok = ReadInteger(argc, argv, i, seed) && seed <= 0xffffffffLL;
+            config.seed = static_cast<uint32_t>(seed);
+            config.hasSeed = ok;
+        } else if (flag == "--threads") {
+            int threads = 0;
+            ok = ReadInt(argc, argv, i, threads);
+            config.threadCount = static_cast<unsigned>(threads);
+        } else if (flag == "--ticks") {
+            ok = ReadInteger(argc, argv, i, config.maxTicks);
+        } else if (flag == "--time-budget") {
+            ok = ReadDouble(argc, argv, i, config.timeBudgetSeconds) && config.timeBudgetSeconds >= 0.0;
+        } else if (flag == "--fps") {
+            ok = ReadInt(argc, argv, i, config.targetFrameRate);
+        } else if (flag == "--lod-threshold") {
+            long long threshold = 0;
+            ok = ReadInteger(argc, argv, i, threshold) && threshold >= 0;
+            config.lodThreshold = static_cast<size_t>(threshold);
+        } else if (flag == "--dt") {
+            ok = ReadFloat(argc, argv, i, config.fixedDeltaTime) && config.fixedDeltaTime > 0.0f;
+        } else {
+            std::cerr << "❌ Option inconnue: " << flag << std::endl;
+            return false;
+        }
+
+        if (!ok) {
+            std::cerr << "❌ Valeur invalide pour " << flag << std::endl;
+            return false;
+        }
+    }
+
+    // Sans limite explicite, une simulation sans fenêtre s'arrête après 1000 ticks
+    // (une reconstruction, elle, ne simule au-delà du tick demandé que sur demande)
+    if (config.headless && config.replayPath.empty() && config.maxTicks == 0 && config.timeBudgetSeconds <= 0.0) {
+        config.maxTicks = 1000;
+    }
+    // Niveau de journal par défaut : les événements d'entité restent muets sauf --verbose
+    if (!config.hasLogLevel) {
+        if (config.verbose) config.logLevel = LogLevel::DEBUG;
+        else if (config.headless || !config.ensemblePath.empty()) config.logLevel = LogLevel::WARNING;
+        else config.logLevel = LogLevel::INFO;
+    }
+    return true;
+}
+
+void PrintUsage(const std::string& programName) {
+    std::cout << "Usage: " << programName << " [options]\n"
+              << "  --headless             Simulation sans fenêtre ni rendu\n"
+              << "  --ticks N              Nombre de ticks à simuler (sans fenêtre)\n"
+              << "  --time-budget S        Durée maximale en secondes (sans fenêtre)\n"
+              << "  --dt S                 Pas de temps fixe d'un tick (défaut 1/60)\n"
+              << "  --fps N                Fréquence d'affichage cible (0 = illimitée)\n"
+              << "  --lod-threshold N      Entités visibles au-delà desquelles une carte de densité remplace\n"
+              << "                         les entités (défaut 20000, 0 = jamais)\n"
+              << "  --width W --height H   Taille du monde\n"
+              << "  --herbivores N         Population initiale d'herbivores\n"
+              << "  --carnivores N         Population initiale de carnivores\n"
+              << "  --plants N             Population initiale de plantes\n"
+              << "  --max-entities N       Population maximale\n"
+              << "  --seed S               Graine du générateur (simulation reproductible)\n"
+              << "  --threads N            Threads de simulation (0 = un par cœur)\n"
+              << "  --food-field           Nourriture en champ dense (diffusion et repousse par cellule)\n"
+              << "  --food-cell N          Côté d'une cellule du champ de nourriture (défaut 20)\n"
+              << "  --no-sleep             Met à jour toutes les régions à chaque tick (comparaison)\n"
+              << "  --verbose              Journal des entités (équivaut à --log-level debug)\n"
+              << "  --log-level L          trace, debug, info, warning, error ou none\n"
+              << "  --log-events FICHIER   Événements d'entité en binaire plutôt qu'en texte\n"
+              << "  --load-snapshot F      Reprend la simulation depuis un instantané\n"
+              << "  --save-snapshot F      Instantané en fin d'exécution (sans fenêtre) ou touche S\n"
+              << "  --trace F              Enregistre les événements de chaque tick dans F\n"
+              << "  --keyframe-interval N  Ticks entre deux keyframes de la trace (défaut 600)\n"
+              << "  --replay F             Reconstruit un tick depuis la trace F (sans fenêtre)\n"
+              << "  --replay-tick N        Tick à reconstruire (avec --replay)\n"
+              << "  --simd S               Noyaux vectoriels (steering, champ): auto, avx2, sse2 ou scalar\n"
+              << "  --stats-csv F          Historique par tick (populations, naissances, morts, énergie) en CSV\n"
+              << "  --stats-history N      Ticks conservés dans l'historique (défaut 3600)\n"
+              << "  --profile F            Trace de profilage au format Chrome (chrome://tracing)\n"
+              << "  --ensemble F           Exécute l'ensemble de runs décrit dans F (grille ou hypercube latin),\n"
+              << "                         un écosystème par worker (--threads workers, 0 = un par cœur)\n"
+              << "  --ensemble-out F       Fichier de résultats en colonnes de l'ensemble (défaut ensemble.bin)\n"
+              << "  --tiles CxR            Découpe le monde en C x R tuiles, un processus par tuile (sans fenêtre,\n"
+              << "                         --ticks obligatoire, --threads par tuile, 1 par défaut)\n"
+              << "  --tile-buffer MB       Boîte aux lettres de chaque tuile en mémoire partagée (défaut 64)\n"
+              << "  --tile-check           Vérifie l'empreinte finale contre une exécution en un seul processus\n"
+              << "  --help                 Affiche cette aide" << std::endl;
+}
+
+} // namespace Core
+} // namespace Ecosystem
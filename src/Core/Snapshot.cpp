@@ -0,0 +1,230 @@
+#include "Core/Snapshot.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+namespace {
+
+const char SNAPSHOT_MAGIC[8] = {'E', 'C', 'O', 'S', 'N', 'A', 'P', '\0'};
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+const uint64_t SECTION_ALIGNMENT = 64;
+
+// En-tête fixe de 64 octets
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t sectionCount;
+    uint32_t reserved0;
+    uint64_t checksum;      // Ecosystem::ComputeChecksum() au moment de la sauvegarde
+    uint64_t fileSize;
+    unsigned char reserved[24];
+};
+static_assert(sizeof(FileHeader) == 64, "en-tête d'instantané de 64 octets");
+
+struct FileSection {
+    uint32_t tag;
+    uint32_t elementSize;
+    uint64_t count;
+    uint64_t offset;  // Depuis le début du fichier, multiple de SECTION_ALIGNMENT
+};
+static_assert(sizeof(FileSection) == 24, "entrée de section de 24 octets");
+
+uint64_t AlignUp(uint64_t value) {
+    return (value + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+}
+
+} // namespace
+
+// ✍️ ÉCRITURE
+bool SnapshotWriter::Write(const std::string& path, uint64_t checksum) const {
+    // 📐 Disposition : en-tête, table, puis les colonnes alignées
+    std::vector<FileSection> table(mSections.size());
+    uint64_t offset = AlignUp(sizeof(FileHeader) + table.size() * sizeof(FileSection));
+    for (size_t i = 0; i < mSections.size(); ++i) {
+        table[i] = {static_cast<uint32_t>(mSections[i].tag), mSections[i].elementSize,
+                    mSections[i].count, offset};
+        offset = AlignUp(offset + mSections[i].count * mSections[i].elementSize);
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.sectionCount = static_cast<uint32_t>(table.size());
+    header.checksum = checksum;
+    header.fileSize = offset;
+
+    const std::string temporaryPath = path + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "❌ Impossible d'écrire l'instantané: " << temporaryPath << std::endl;
+            return false;
+        }
+        static const char padding[SECTION_ALIGNMENT] = {};
+        uint64_t written = 0;
+        auto write = [&](const void* data, uint64_t bytes) {
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+            written += bytes;
+        };
+        write(&header, sizeof(header));
+        write(table.data(), table.size() * sizeof(FileSection));
+        for (size_t i = 0; i < mSections.size(); ++i) {
+            write(padding, table[i].offset - written);
+            const Section& section = mSections[i];
+            const void* data = section.ownedIndex == SIZE_MAX ? section.data : mOwned[section.ownedIndex].data();
+            write(data, section.count * section.elementSize);
+        }
+        write(padding, header.fileSize - written);
+        file.flush();
+        if (!file) {
+            std::cerr << "❌ Écriture de l'instantané incomplète: " << temporaryPath << std::endl;
+            file.close();
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        std::cerr << "❌ Impossible de remplacer l'instantané: " << path << std::endl;
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// 🏗 CONSTRUCTEUR / DESTRUCTEUR
+SnapshotReader::SnapshotReader()
+    : mData(nullptr), mSize(0), mMapping(nullptr), mSections(nullptr), mSectionCount(0), mChecksum(0) {}
+
+SnapshotReader::~SnapshotReader() {
+    Close();
+}
+
+void SnapshotReader::Close() {
+#if !defined(_WIN32)
+    if (mMapping) munmap(mMapping, mSize);
+#endif
+    mMapping = nullptr;
+    mFallback.clear();
+    mData = nullptr;
+    mSize = 0;
+    mSections = nullptr;
+    mSectionCount = 0;
+}
+
+// 📂 OUVERTURE : projection du fichier puis validation de l'en-tête et de la table
+bool SnapshotReader::Open(const std::string& path) {
+    Close();
+#if !defined(_WIN32)
+    const int descriptor = open(path.c_str(), O_RDONLY);
+    struct stat info;
+    if (descriptor < 0 || fstat(descriptor, &info) != 0) {
+        if (descriptor >= 0) close(descriptor);
+        std::cerr << "❌ Impossible d'ouvrir l'instantané: " << path << std::endl;
+        return false;
+    }
+    mSize = static_cast<size_t>(info.st_size);
+    if (mSize > 0) {
+        void* mapping = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping != MAP_FAILED) {
+            madvise(mapping, mSize, MADV_SEQUENTIAL);  // Lecture colonne par colonne
+            mMapping = mapping;
+            mData = static_cast<const unsigned char*>(mapping);
+        }
+    }
+    close(descriptor);
+    if (!mData && mSize > 0) {
+        std::cerr << "❌ Impossible de projeter l'instantané: " << path << std::endl;
+        mSize = 0;
+        return false;
+    }
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::cerr << "❌ Impossible d'ouvrir l'instantané: " << path << std::endl;
+        return false;
+    }
+    mFallback.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(mFallback.data()), static_cast<std::streamsize>(mFallback.size()));
+    mData = mFallback.data();
+    mSize = mFallback.size();
+#endif
+
+    FileHeader header;
+    if (mSize < sizeof(header)) {
+        std::cerr << "❌ Instantané tronqué: " << path << std::endl;
+        Close();
+        return false;
+    }
+    std::memcpy(&header, mData, sizeof(header));
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 ||
+        header.byteOrder != BYTE_ORDER_MARK) {
+        std::cerr << "❌ Fichier d'instantané invalide: " << path << std::endl;
+        Close();
+        return false;
+    }
+    if (header.version != SNAPSHOT_VERSION) {
+        std::cerr << "❌ Version d'instantané non prise en charge (" << header.version << "): " << path << std::endl;
+        Close();
+        return false;
+    }
+    const uint64_t tableEnd = sizeof(header) + static_cast<uint64_t>(header.sectionCount) * sizeof(FileSection);
+    if (header.fileSize != mSize || tableEnd > mSize) {
+        std::cerr << "❌ Instantané tronqué: " << path << std::endl;
+        Close();
+        return false;
+    }
+    mSections = reinterpret_cast<const SectionEntry*>(mData + sizeof(header));
+    mSectionCount = header.sectionCount;
+    for (uint32_t i = 0; i < mSectionCount; ++i) {
+        const SectionEntry& section = mSections[i];
+        const uint64_t bytes = section.count * section.elementSize;
+        if (section.offset % SECTION_ALIGNMENT != 0 || section.offset > mSize || bytes > mSize - section.offset ||
+            (section.elementSize != 0 && bytes / section.elementSize != section.count)) {
+            std::cerr << "❌ Section d'instantané hors du fichier: " << path << std::endl;
+            Close();
+            return false;
+        }
+    }
+    mChecksum = header.checksum;
+    return true;
+}
+
+// 🔍 RECHERCHE D'UNE SECTION
+bool SnapshotReader::Has(SnapshotSection tag) const {
+    for (uint32_t i = 0; i < mSectionCount; ++i) {
+        if (mSections[i].tag == static_cast<uint32_t>(tag)) return true;
+    }
+    return false;
+}
+
+const void* SnapshotReader::Find(SnapshotSection tag, size_t elementSize, size_t& count) const {
+    for (uint32_t i = 0; i < mSectionCount; ++i) {
+        const SectionEntry& section = mSections[i];
+        if (section.tag != static_cast<uint32_t>(tag)) continue;
+        if (section.elementSize != elementSize) {
+            std::cerr << "❌ Section d'instantané " << section.tag << " : éléments de " << section.elementSize
+                      << " octets, " << elementSize << " attendus" << std::endl;
+            return nullptr;
+        }
+        count = static_cast<size_t>(section.count);
+        return mData + section.offset;
+    }
+    std::cerr << "❌ Section d'instantané manquante: " << static_cast<uint32_t>(tag) << std::endl;
+    return nullptr;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,44 @@
+#include "Core/SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+SpatialGrid::SpatialGrid(float worldWidth, float worldHeight, float cellSize)
+    : mWorldWidth(0.0f), mWorldHeight(0.0f), mCellSize(1.0f), mInvCellSize(1.0f),
+      mColumns(1), mRows(1), mSparse(false)
+{
+    Configure(worldWidth, worldHeight, cellSize);
+}
+
+// ⚙️ CONFIGURATION
+void SpatialGrid::Configure(float worldWidth, float worldHeight, float cellSize) {
+    mWorldWidth = worldWidth;
+    mWorldHeight = worldHeight;
+    mCellSize = cellSize > 0.0f ? cellSize : 1.0f;
+    mInvCellSize = 1.0f / mCellSize;
+    mColumns = std::max(1, static_cast<int>(std::ceil(worldWidth / mCellSize)));
+    mRows = std::max(1, static_cast<int>(std::ceil(worldHeight / mCellSize)));
+    Clear();
+}
+
+void SpatialGrid::Clear() {
+    mCellStart.assign(static_cast<size_t>(mColumns) * static_cast<size_t>(mRows) + 1, 0);
+    mItems.clear();
+    mItemPositions.clear();
+    mSparse = false;
+}
+
+// 🔍 REQUÊTE PAR RAYON (indices triés pour un résultat déterministe)
+void SpatialGrid::QueryRadius(Vector2D center, float radius, std::vector<uint32_t>& out) const {
+    out.clear();
+    ForEachInRadius(center, radius, [&out](uint32_t index, float) {
+        out.push_back(index);
+    });
+    std::sort(out.begin(), out.end());
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,51 @@
+#include "Core/StatisticsHistory.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR : toute la mémoire est réservée ici
+StatisticsHistory::StatisticsHistory(size_t capacity)
+    : mSamples(std::max<size_t>(capacity, 1)), mHead(0), mSize(0) {}
+
+// ➕ AJOUT D'UN ÉCHANTILLON (écrase le plus ancien si l'anneau est plein)
+void StatisticsHistory::Push(const StatisticsSample& sample) {
+    mSamples[mHead] = sample;
+    mHead = (mHead + 1) % mSamples.size();
+    mSize = std::min(mSize + 1, mSamples.size());
+}
+
+void StatisticsHistory::Clear() {
+    mHead = 0;
+    mSize = 0;
+}
+
+// 💾 EXPORT CSV
+bool StatisticsHistory::WriteCsv(const std::string& path) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        std::cerr << "❌ Impossible d'écrire l'historique des statistiques: " << path << std::endl;
+        return false;
+    }
+    file << "tick,herbivores,carnivores,plants,births,deaths,food,mean_energy\n";
+    char line[160];
+    for (size_t i = 0; i < mSize; ++i) {
+        const StatisticsSample& sample = (*this)[i];
+        std::snprintf(line, sizeof(line), "%u,%d,%d,%d,%d,%d,%d,%.4f\n", sample.tick, sample.herbivores,
+                      sample.carnivores, sample.plants, sample.births, sample.deaths, sample.food,
+                      sample.meanEnergy);
+        file << line;
+    }
+    file.flush();
+    if (!file) {
+        std::cerr << "❌ Écriture de l'historique des statistiques incomplète: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,295 @@
+#include "Core/Steering.h"
+#include <algorithm>
+
+#if defined(ECO_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+namespace {
+
+// 🧮 UNE VOIE, FORMULES DE RÉFÉRENCE (chemin scalaire et fin des lots vectoriels)
+void SteerLane(SteeringBatch& batch, size_t lane, float worldWidth, float worldHeight) {
+    const Vector2D position(batch.x[lane], batch.y[lane]);
+    Vector2D seek(0.0f, 0.0f);
+    if (batch.hasTarget[lane]) {
+        seek = Steering::SeekTowards(position, Vector2D(batch.targetX[lane], batch.targetY[lane]));
+    }
+    Vector2D steer{0.0f, 0.0f};
+    float totalWeight = 0.0f;
+    const uint32_t end = batch.fleeBegin[lane] + batch.fleeCount[lane];
+    for (uint32_t p = batch.fleeBegin[lane]; p < end; ++p) {
+        Steering::AccumulateFlee(position, Vector2D(batch.predatorX[p], batch.predatorY[p]), steer, totalWeight,
+                                 batch.avoidRadius);
+    }
+    const Vector2D force = seek + Steering::FinishFlee(steer, totalWeight)
+                         + Steering::StayInBounds(position, worldWidth, worldHeight);
+    const Vector2D velocity = Steering::ApplyForce(Vector2D(batch.vx[lane], batch.vy[lane]), force, batch.maxSpeed);
+    batch.vx[lane] = velocity.x;
+    batch.vy[lane] = velocity.y;
+}
+
+void SteerScalar(SteeringBatch& batch, size_t begin, float worldWidth, float worldHeight) {
+    for (size_t lane = begin; lane < batch.Size(); ++lane) {
+        SteerLane(batch, lane, worldWidth, worldHeight);
+    }
+}
+
+#if defined(ECO_SIMD_SSE2)
+// 🔀 Sélection par masque (SSE2 n'a pas de blendv) : mask ? a : b
+inline __m128 Select(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// 4️⃣ QUATRE VOIES PAR INSTRUCTION
+// Comparaisons choisies pour reproduire les branches scalaires, NaN compris :
+// "if (len <= e) return 0" devient cmpnle (vrai si non ordonné).
+void SteerSse2(SteeringBatch& batch, float worldWidth, float worldHeight) {
+    const size_t count = batch.Size();
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 epsilon = _mm_set1_ps(1e-6f);
+    const __m128 maxForce = _mm_set1_ps(MAX_STEERING_FORCE);
+    const __m128 avoidRadiusSq = _mm_set1_ps(batch.avoidRadius * batch.avoidRadius);
+    const __m128 margin = _mm_set1_ps(BOUNDS_MARGIN);
+    const __m128 right = _mm_set1_ps(worldWidth - BOUNDS_MARGIN);
+    const __m128 bottom = _mm_set1_ps(worldHeight - BOUNDS_MARGIN);
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 maxSpeed = _mm_set1_ps(batch.maxSpeed);
+    const __m128 maxSpeedSq = _mm_set1_ps(batch.maxSpeed * batch.maxSpeed);
+
+    size_t lane = 0;
+    for (; lane + 4 <= count; lane += 4) {
+        const __m128 x = _mm_loadu_ps(&batch.x[lane]);
+        const __m128 y = _mm_loadu_ps(&batch.y[lane]);
+
+        // 🍎 Recherche de nourriture
+        const __m128 hasTarget = _mm_castsi128_ps(_mm_cmpgt_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(&batch.hasTarget[lane])), _mm_setzero_si128()));
+        const __m128 seekDx = _mm_sub_ps(_mm_loadu_ps(&batch.targetX[lane]), x);
+        const __m128 seekDy = _mm_sub_ps(_mm_loadu_ps(&batch.targetY[lane]), y);
+        const __m128 seekLen = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(seekDx, seekDx), _mm_mul_ps(seekDy, seekDy)));
+        const __m128 seekOk = _mm_and_ps(hasTarget, _mm_cmpnle_ps(seekLen, epsilon));
+        const __m128 seekX = Select(seekOk, _mm_mul_ps(_mm_div_ps(seekDx, seekLen), maxForce), zero);
+        const __m128 seekY = Select(seekOk, _mm_mul_ps(_mm_div_ps(seekDy, seekLen), maxForce), zero);
+
+        // 🏃 Fuite : chaque voie parcourt ses propres prédateurs, dans l'ordre
+        uint32_t begins[4];
+        uint32_t counts[4];
+        uint32_t maxCount = 0;
+        for (int l = 0; l < 4; ++l) {
+            begins[l] = batch.fleeBegin[lane + l];
+            counts[l] = batch.fleeCount[lane + l];
+            maxCount = std::max(maxCount, counts[l]);
+        }
+        __m128 steerX = zero;
+        __m128 steerY = zero;
+        __m128 totalWeight = zero;
+        for (uint32_t k = 0; k < maxCount; ++k) {
+            float px[4];
+            float py[4];
+            float active[4];
+            for (int l = 0; l < 4; ++l) {
+                const bool inRange = k < counts[l];
+                px[l] = inRange ? batch.predatorX[begins[l] + k] : 0.0f;
+                py[l] = inRange ? batch.predatorY[begins[l] + k] : 0.0f;
+                active[l] = inRange ? 1.0f : 0.0f;
+            }
+            const __m128 dx = _mm_sub_ps(x, _mm_loadu_ps(px));
+            const __m128 dy = _mm_sub_ps(y, _mm_loadu_ps(py));
+            const __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            const __m128 threat = _mm_and_ps(_mm_cmpgt_ps(_mm_loadu_ps(active), zero),
+                                            _mm_and_ps(_mm_cmpgt_ps(distSq, zero), _mm_cmplt_ps(distSq, avoidRadiusSq)));
+            const __m128 weight = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(distSq));
+            steerX = Select(threat, _mm_add_ps(steerX, _mm_mul_ps(dx, weight)), steerX);
+            steerY = Select(threat, _mm_add_ps(steerY, _mm_mul_ps(dy, weight)), steerY);
+            totalWeight = Select(threat, _mm_add_ps(totalWeight, weight), totalWeight);
+        }
+        const __m128 meanX = _mm_div_ps(steerX, totalWeight);
+        const __m128 meanY = _mm_div_ps(steerY, totalWeight);
+        const __m128 fleeLen = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(meanX, meanX), _mm_mul_ps(meanY, meanY)));
+        const __m128 fleeOk = _mm_and_ps(_mm_cmpnle_ps(totalWeight, zero), _mm_cmpnle_ps(fleeLen, epsilon));
+        const __m128 fleeX = Select(fleeOk, _mm_mul_ps(_mm_div_ps(meanX, fleeLen), maxForce), zero);
+        const __m128 fleeY = Select(fleeOk, _mm_mul_ps(_mm_div_ps(meanY, fleeLen), maxForce), zero);
+
+        // 🧱 Limites du monde
+        __m128 boundsX = Select(_mm_cmpgt_ps(x, right), _mm_sub_ps(right, x), zero);
+        boundsX = Select(_mm_cmplt_ps(x, margin), _mm_sub_ps(margin, x), boundsX);
+        __m128 boundsY = Select(_mm_cmpgt_ps(y, bottom), _mm_sub_ps(bottom, y), zero);
+        boundsY = Select(_mm_cmplt_ps(y, margin), _mm_sub_ps(margin, y), boundsY);
+        const __m128 negligible = _mm_and_ps(_mm_cmplt_ps(_mm_and_ps(boundsX, absMask), epsilon),
+                                             _mm_cmplt_ps(_mm_and_ps(boundsY, absMask), epsilon));
+        const __m128 boundsLen = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(boundsX, boundsX), _mm_mul_ps(boundsY, boundsY)));
+        const __m128 normalize = _mm_cmpgt_ps(boundsLen, epsilon);
+        boundsX = Select(normalize, _mm_mul_ps(_mm_div_ps(boundsX, boundsLen), maxForce), boundsX);
+        boundsY = Select(normalize, _mm_mul_ps(_mm_div_ps(boundsY, boundsLen), maxForce), boundsY);
+        boundsX = Select(negligible, zero, boundsX);
+        boundsY = Select(negligible, zero, boundsY);
+
+        // ➕ Somme des forces puis limitation de la vitesse
+        const __m128 forceX = _mm_add_ps(_mm_add_ps(seekX, fleeX), boundsX);
+        const __m128 forceY = _mm_add_ps(_mm_add_ps(seekY, fleeY), boundsY);
+        __m128 vx = _mm_add_ps(_mm_loadu_ps(&batch.vx[lane]), forceX);
+        __m128 vy = _mm_add_ps(_mm_loadu_ps(&batch.vy[lane]), forceY);
+        const __m128 speedSq = _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy));
+        const __m128 tooFast = _mm_cmpgt_ps(speedSq, maxSpeedSq);
+        const __m128 scale = _mm_div_ps(maxSpeed, _mm_sqrt_ps(speedSq));
+        vx = Select(tooFast, _mm_mul_ps(vx, scale), vx);
+        vy = Select(tooFast, _mm_mul_ps(vy, scale), vy);
+        _mm_storeu_ps(&batch.vx[lane], vx);
+        _mm_storeu_ps(&batch.vy[lane], vy);
+    }
+    SteerScalar(batch, lane, worldWidth, worldHeight);
+}
+#endif
+
+#if defined(ECO_SIMD_AVX2)
+// 8️⃣ HUIT VOIES PAR INSTRUCTION : mêmes étapes que SteerSse2, prédateurs lus par gather
+ECO_TARGET_AVX2 void SteerAvx2(SteeringBatch& batch, float worldWidth, float worldHeight) {
+    const size_t count = batch.Size();
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 epsilon = _mm256_set1_ps(1e-6f);
+    const __m256 maxForce = _mm256_set1_ps(MAX_STEERING_FORCE);
+    const __m256 avoidRadiusSq = _mm256_set1_ps(batch.avoidRadius * batch.avoidRadius);
+    const __m256 margin = _mm256_set1_ps(BOUNDS_MARGIN);
+    const __m256 right = _mm256_set1_ps(worldWidth - BOUNDS_MARGIN);
+    const __m256 bottom = _mm256_set1_ps(worldHeight - BOUNDS_MARGIN);
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256 maxSpeed = _mm256_set1_ps(batch.maxSpeed);
+    const __m256 maxSpeedSq = _mm256_set1_ps(batch.maxSpeed * batch.maxSpeed);
+
+    size_t lane = 0;
+    for (; lane + 8 <= count; lane += 8) {
+        const __m256 x = _mm256_loadu_ps(&batch.x[lane]);
+        const __m256 y = _mm256_loadu_ps(&batch.y[lane]);
+
+        // 🍎 Recherche de nourriture
+        const __m256 hasTarget = _mm256_castsi256_ps(_mm256_cmpgt_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&batch.hasTarget[lane])), _mm256_setzero_si256()));
+        const __m256 seekDx = _mm256_sub_ps(_mm256_loadu_ps(&batch.targetX[lane]), x);
+        const __m256 seekDy = _mm256_sub_ps(_mm256_loadu_ps(&batch.targetY[lane]), y);
+        const __m256 seekLen = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(seekDx, seekDx), _mm256_mul_ps(seekDy, seekDy)));
+        const __m256 seekOk = _mm256_and_ps(hasTarget, _mm256_cmp_ps(seekLen, epsilon, _CMP_NLE_UQ));
+        const __m256 seekX = _mm256_blendv_ps(zero, _mm256_mul_ps(_mm256_div_ps(seekDx, seekLen), maxForce), seekOk);
+        const __m256 seekY = _mm256_blendv_ps(zero, _mm256_mul_ps(_mm256_div_ps(seekDy, seekLen), maxForce), seekOk);
+
+        // 🏃 Fuite
+        const __m256i begins = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&batch.fleeBegin[lane]));
+        const __m256i counts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&batch.fleeCount[lane]));
+        uint32_t maxCount = 0;
+        for (int l = 0; l < 8; ++l) maxCount = std::max(maxCount, batch.fleeCount[lane + l]);
+        __m256 steerX = zero;
+        __m256 steerY = zero;
+        __m256 totalWeight = zero;
+        for (uint32_t k = 0; k < maxCount; ++k) {
+            const __m256i step = _mm256_set1_epi32(static_cast<int>(k));
+            const __m256 inRange = _mm256_castsi256_ps(_mm256_cmpgt_epi32(counts, step));
+            const __m256i slots = _mm256_add_epi32(begins, step);
+            const __m256 px = _mm256_mask_i32gather_ps(zero, batch.predatorX.data(), slots, inRange, 4);
+            const __m256 py = _mm256_mask_i32gather_ps(zero, batch.predatorY.data(), slots, inRange, 4);
+            const __m256 dx = _mm256_sub_ps(x, px);
+            const __m256 dy = _mm256_sub_ps(y, py);
+            const __m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            const __m256 threat = _mm256_and_ps(inRange, _mm256_and_ps(_mm256_cmp_ps(distSq, zero, _CMP_GT_OQ),
+                                                                      _mm256_cmp_ps(distSq, avoidRadiusSq, _CMP_LT_OQ)));
+            const __m256 weight = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(distSq));
+            steerX = _mm256_blendv_ps(steerX, _mm256_add_ps(steerX, _mm256_mul_ps(dx, weight)), threat);
+            steerY = _mm256_blendv_ps(steerY, _mm256_add_ps(steerY, _mm256_mul_ps(dy, weight)), threat);
+            totalWeight = _mm256_blendv_ps(totalWeight, _mm256_add_ps(totalWeight, weight), threat);
+        }
+        const __m256 meanX = _mm256_div_ps(steerX, totalWeight);
+        const __m256 meanY = _mm256_div_ps(steerY, totalWeight);
+        const __m256 fleeLen = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(meanX, meanX), _mm256_mul_ps(meanY, meanY)));
+        const __m256 fleeOk = _mm256_and_ps(_mm256_cmp_ps(totalWeight, zero, _CMP_NLE_UQ),
+                                            _mm256_cmp_ps(fleeLen, epsilon, _CMP_NLE_UQ));
+        const __m256 fleeX = _mm256_blendv_ps(zero, _mm256_mul_ps(_mm256_div_ps(meanX, fleeLen), maxForce), fleeOk);
+        const __m256 fleeY = _mm256_blendv_ps(zero, _mm256_mul_ps(_mm256_div_ps(meanY, fleeLen), maxForce), fleeOk);
+
+        // 🧱 Limites du monde
+        __m256 boundsX = _mm256_blendv_ps(zero, _mm256_sub_ps(right, x), _mm256_cmp_ps(x, right, _CMP_GT_OQ));
+        boundsX = _mm256_blendv_ps(boundsX, _mm256_sub_ps(margin, x), _mm256_cmp_ps(x, margin, _CMP_LT_OQ));
+        __m256 boundsY = _mm256_blendv_ps(zero, _mm256_sub_ps(bottom, y), _mm256_cmp_ps(y, bottom, _CMP_GT_OQ));
+        boundsY = _mm256_blendv_ps(boundsY, _mm256_sub_ps(margin, y), _mm256_cmp_ps(y, margin, _CMP_LT_OQ));
+        const __m256 negligible = _mm256_and_ps(_mm256_cmp_ps(_mm256_and_ps(boundsX, absMask), epsilon, _CMP_LT_OQ),
+                                                _mm256_cmp_ps(_mm256_and_ps(boundsY, absMask), epsilon, _CMP_LT_OQ));
+        const __m256 boundsLen = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(boundsX, boundsX), _mm256_mul_ps(boundsY, boundsY)));
+        const __m256 normalize = _mm256_cmp_ps(boundsLen, epsilon, _CMP_GT_OQ);
+        boundsX = _mm256_blendv_ps(boundsX, _mm256_mul_ps(_mm256_div_ps(boundsX, boundsLen), maxForce), normalize);
+        boundsY = _mm256_blendv_ps(boundsY, _mm256_mul_ps(_mm256_div_ps(boundsY, boundsLen), maxForce), normalize);
+        boundsX = _mm256_blendv_ps(boundsX, zero, negligible);
+        boundsY = _mm256_blendv_ps(boundsY, zero, negligible);
+
+        // ➕ Somme des forces puis limitation de la vitesse
+        const __m256 forceX = _mm256_add_ps(_mm256_add_ps(seekX, fleeX), boundsX);
+        const __m256 forceY = _mm256_add_ps(_mm256_add_ps(seekY, fleeY), boundsY);
+        __m256 vx = _mm256_add_ps(_mm256_loadu_ps(&batch.vx[lane]), forceX);
+        __m256 vy = _mm256_add_ps(_mm256_loadu_ps(&batch.vy[lane]), forceY);
+        const __m256 speedSq = _mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy));
+        const __m256 tooFast = _mm256_cmp_ps(speedSq, maxSpeedSq, _CMP_GT_OQ);
+        const __m256 scale = _mm256_div_ps(maxSpeed, _mm256_sqrt_ps(speedSq));
+        vx = _mm256_blendv_ps(vx, _mm256_mul_ps(vx, scale), tooFast);
+        vy = _mm256_blendv_ps(vy, _mm256_mul_ps(vy, scale), tooFast);
+        _mm256_storeu_ps(&batch.vx[lane], vx);
+        _mm256_storeu_ps(&batch.vy[lane], vy);
+    }
+    SteerScalar(batch, lane, worldWidth, worldHeight);
+}
+#endif
+
+} // namespace
+
+// 📦 LOT
+void SteeringBatch::Clear() {
+    index.clear();
+    x.clear();
+    y.clear();
+    vx.clear();
+    vy.clear();
+    targetX.clear();
+    targetY.clear();
+    hasTarget.clear();
+    fleeBegin.clear();
+    fleeCount.clear();
+    predatorX.clear();
+    predatorY.clear();
+}
+
+void SteeringBatch::Add(uint32_t entityIndex, Vector2D position, Vector2D velocity, const Vector2D* target) {
+    index.push_back(entityIndex);
+    x.push_back(position.x);
+    y.push_back(position.y);
+    vx.push_back(velocity.x);
+    vy.push_back(velocity.y);
+    targetX.push_back(target ? target->x : 0.0f);
+    targetY.push_back(target ? target->y : 0.0f);
+    hasTarget.push_back(target ? 1u : 0u);
+    fleeBegin.push_back(static_cast<uint32_t>(predatorX.size()));
+    fleeCount.push_back(0);
+}
+
+// 🧭 NOYAU
+void SteerBatch(SteeringBatch& batch, float worldWidth, float worldHeight) {
+    SteerBatch(batch, worldWidth, worldHeight, GetSimdPath());
+}
+
+void SteerBatch(SteeringBatch& batch, float worldWidth, float worldHeight, SimdPath path) {
+    switch (path == SimdPath::AUTO ? GetSimdPath() : path) {
+#if defined(ECO_SIMD_AVX2)
+        case SimdPath::AVX2:
+            SteerAvx2(batch, worldWidth, worldHeight);
+            return;
+#endif
+#if defined(ECO_SIMD_SSE2)
+        case SimdPath::SSE2:
+            SteerSse2(batch, worldWidth, worldHeight);
+            return;
+#endif
+        default:
+            SteerScalar(batch, 0, worldWidth, worldHeight);
+            return;
+    }
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,123 @@
+#include "Core/TaskScheduler.h"
+#include "Core/Profiler.h"
+#include <algorithm>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+TaskScheduler::TaskScheduler(unsigned threadCount)
+    : mThreadCount(threadCount == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threadCount),
+      mCurrentTask(nullptr), mPendingChunks(0), mGeneration(0), mStopping(false)
+{
+    for (unsigned i = 0; i < mThreadCount; ++i) {
+        mQueues.push_back(std::make_unique<WorkerQueue>());
+    }
+    // Le thread appelant est le travailleur 0
+    for (unsigned i = 1; i < mThreadCount; ++i) {
+        mThreads.emplace_back(&TaskScheduler::WorkerLoop, this, i);
+    }
+}
+
+// 🗑 DESTRUCTEUR
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mStopping = true;
+    }
+    mWakeCondition.notify_all();
+    for (auto& thread : mThreads) {
+        thread.join();
+    }
+}
+
+// ⚙️ EXÉCUTION PARALLÈLE
+void TaskScheduler::ParallelFor(size_t count, size_t grainSize, const RangeTask& body) {
+    if (count == 0) return;
+    grainSize = std::max<size_t>(1, grainSize);
+
+    // Exécution directe : un seul thread ou une seule tranche
+    if (mThreadCount == 1 || count <= grainSize) {
+        for (size_t begin = 0; begin < count; begin += grainSize) {
+            body(begin, std::min(count, begin + grainSize), 0);
+        }
+        return;
+    }
+
+    const size_t chunkCount = (count + grainSize - 1) / grainSize;
+    mCurrentTask.store(&body, std::memory_order_release);
+    mPendingChunks.store(chunkCount, std::memory_order_release);
+
+    // Répartition circulaire des tranches dans les files
+    for (size_t c = 0; c < chunkCount; ++c) {
+        WorkerQueue& queue = *mQueues[c % mThreadCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.chunks.push_back({c * grainSize, std::min(count, (c + 1) * grainSize)});
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        ++mGeneration;
+    }
+    mWakeCondition.notify_all();
+
+    // Le thread appelant travaille aussi, puis attend les tranches encore en cours
+    while (RunOneChunk(0)) {}
+    std::unique_lock<std::mutex> lock(mWakeMutex);
+    mDoneCondition.wait(lock, [this] { return mPendingChunks.load(std::memory_order_acquire) == 0; });
+    mCurrentTask.store(nullptr, std::memory_order_release);
+}
+
+// 🔁 BOUCLE D'UN TRAVAILLEUR
+void TaskScheduler::WorkerLoop(unsigned worker) {
+    unsigned long long seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mWakeMutex);
+            mWakeCondition.wait(lock, [&] { return mStopping || mGeneration != seenGeneration; });
+            if (mStopping) return;
+            seenGeneration = mGeneration;
+        }
+        while (RunOneChunk(worker)) {}
+    }
+}
+
+// 🎯 UNE TRANCHE : d'abord sa propre file (par la fin), sinon vol (par le début)
+bool TaskScheduler::RunOneChunk(unsigned worker) {
+    Chunk chunk{0, 0};
+    bool found = false;
+    {
+        WorkerQueue& own = *mQueues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.chunks.empty()) {
+            chunk = own.chunks.back();
+            own.chunks.pop_back();
+            found = true;
+        }
+    }
+    for (unsigned offset = 1; !found && offset < mThreadCount; ++offset) {
+        WorkerQueue& victim = *mQueues[(worker + offset) % mThreadCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.chunks.empty()) {
+            chunk = victim.chunks.front();
+            victim.chunks.pop_front();
+            found = true;
+        }
+    }
+    if (!found) return false;
+
+    const RangeTask* task = mCurrentTask.load(std::memory_order_acquire);
+    {
+        ECO_PROFILE_ZONE("TaskScheduler::Chunk");
+        (*task)(chunk.begin, chunk.end, worker);
+    }
+
+    if (mPendingChunks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mDoneCondition.notify_all();
+    }
+    return true;
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,151 @@
+#include "Core/TileDomain.h"
+#include "Core/Ecosystem.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+namespace Ecosystem {
+namespace Core {
+
+// 🏗 CONSTRUCTEUR
+TileDomain::TileDomain(TileExchange& exchange, int columns, int rows, float worldWidth, float worldHeight)
+    : mExchange(exchange), mColumns(columns), mRows(rows),
+      mTileWidth(worldWidth / columns), mTileHeight(worldHeight / rows), mLiveCount(0) {}
+
+// 📐 GÉOMÉTRIE : les tuiles du bord prennent tout ce qui dépasse du monde
+int TileDomain::ColumnOf(float x) const {
+    const float column = std::floor(x / mTileWidth);
+    if (!(column >= 0.0f)) return 0;  // NaN compris
+    return column >= static_cast<float>(mColumns) ? mColumns - 1 : static_cast<int>(column);
+}
+
+int TileDomain::RowOf(float y) const {
+    const float row = std::floor(y / mTileHeight);
+    if (!(row >= 0.0f)) return 0;
+    return row >= static_cast<float>(mRows) ? mRows - 1 : static_cast<int>(row);
+}
+
+int TileDomain::OwnerOf(Vector2D position) const {
+    return RowOf(position.y) * mColumns + ColumnOf(position.x);
+}
+
+void TileDomain::RanksNear(Vector2D position, float margin, std::vector<int>& out) const {
+    const int firstColumn = ColumnOf(position.x - margin);
+    const int lastColumn = ColumnOf(position.x + margin);
+    const int firstRow = RowOf(position.y - margin);
+    const int lastRow = RowOf(position.y + margin);
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) out.push_back(row * mColumns + column);
+    }
+}
+
+namespace {
+
+// Ce que le découpage ne sait pas faire : false (et ❌) au lieu d'un résultat faux
+bool CheckTileConfig(const SimulationConfig& config) {
+    const char* unsupported = nullptr;
+    if (config.maxTicks <= 0 || config.timeBudgetSeconds > 0.0) unsupported = "une durée en temps réel (--ticks seul)";
+    else if (config.foodField) unsupported = "--food-field";
+    else if (!config.tracePath.empty() || !config.replayPath.empty()) unsupported = "la trace d'événements";
+    else if (!config.loadSnapshotPath.empty() || !config.saveSnapshotPath.empty()) unsupported = "les instantanés";
+    else if (!config.statsHistoryPath.empty()) unsupported = "--stats-csv";
+    else if (!config.profilePath.empty()) unsupported = "--profile";
+    else if (!config.ensemblePath.empty()) unsupported = "--ensemble";
+    if (!unsupported) return true;
+    std::cerr << "❌ Découpage en tuiles incompatible avec " << unsupported << std::endl;
+    return false;
+}
+
+// Le parallélisme est d'abord entre les tuiles
+unsigned TileThreadCount(const SimulationConfig& config) {
+    return config.threadCount > 0 ? config.threadCount : 1;
+}
+
+} // namespace
+
+// 🏁 EXÉCUTION EN TUILES
+bool TileRunner::Run(const SimulationConfig& config, Report& report) {
+    if (!CheckTileConfig(config)) return false;
+    const int ranks = config.tileColumns * config.tileRows;
+    // Graine tirée avant fork() : la même pour tous les rangs
+    const uint32_t seed = config.hasSeed ? config.seed : std::random_device{}();
+    report = Report{0, 0.0, ranks, 0, 0, 0, 0, 0, 0, seed, 0};
+    const size_t mailboxBytes = static_cast<size_t>(config.tileBufferMegabytes) << 20;
+
+    return TileExchange::Launch(ranks, mailboxBytes, [&](TileExchange& exchange) {
+        // Le thread d'écriture du journal n'existe que dans le processus d'origine
+        if (exchange.GetRank() != 0) Logger::SetLevel(LogLevel::NONE);
+        TileDomain domain(exchange, config.tileColumns, config.tileRows, config.worldWidth, config.worldHeight);
+        Ecosystem ecosystem(config.worldWidth, config.worldHeight, config.maxEntities);
+        ecosystem.SetThreadCount(TileThreadCount(config));
+        ecosystem.SetHistoryCapacity(1);  // Historique propre à chaque tuile : inutile ici
+        ecosystem.SetDomain(&domain);
+        ecosystem.SetSeed(seed);
+        ecosystem.Initialize(config.initialHerbivores, config.initialCarnivores, config.initialPlants);
+
+        const auto start = std::chrono::steady_clock::now();
+        long long ticks = 0;
+        for (; ticks < config.maxTicks; ++ticks) {
+            ecosystem.Update(config.fixedDeltaTime);
+            if (domain.HasFailed()) return false;
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // 📦 État final réuni sur le rang 0 : entités possédées et populations de chaque tuile
+        const EntityStore& entities = ecosystem.GetEntities();
+        std::vector<std::vector<EntityRecord>> records(domain.GetRankCount());
+        for (size_t i = 0; i < entities.Size(); ++i) {
+            if (!entities.IsTombstone(i) && !domain.IsGhost(i)) records[0].push_back(entities.ExportRecord(i));
+        }
+        const auto stats = ecosystem.GetStatistics();
+        std::vector<std::vector<int64_t>> counts(domain.GetRankCount());
+        counts[0] = {stats.totalHerbivores, stats.totalCarnivores, stats.totalPlants,
+                     static_cast<int64_t>(records[0].size())};
+        std::vector<std::vector<EntityRecord>> gathered;
+        std::vector<std::vector<int64_t>> gatheredCounts;
+        if (!domain.Exchange(records, gathered) || !domain.Exchange(counts, gatheredCounts)) return false;
+        if (exchange.GetRank() != 0) return true;
+
+        std::vector<EntityRecord> all;
+        for (const std::vector<EntityRecord>& received : gathered) all.insert(all.end(), received.begin(), received.end());
+        std::sort(all.begin(), all.end(), [](const EntityRecord& a, const EntityRecord& b) { return a.id < b.id; });
+        // Mêmes horloges que les tuiles : énergie et âge des plantes inchangés
+        EntityStore merged;
+        merged.plantClocks = entities.plantClocks;
+        merged.Reserve(all.size());
+        std::vector<size_t> rows;
+        merged.MergeRecords(all, rows);
+
+        report.ticks = ticks;
+        report.elapsedSeconds = seconds;
+        for (const std::vector<int64_t>& tile : gatheredCounts) {
+            if (tile.size() < 4) continue;
+            report.herbivores += static_cast<int>(tile[0]);
+            report.carnivores += static_cast<int>(tile[1]);
+            report.plants += static_cast<int>(tile[2]);
+            report.largestTile = std::max(report.largestTile, static_cast<size_t>(tile[3]));
+        }
+        report.food = stats.totalFood;  // Nourriture répliquée : la même partout
+        report.entities = merged.LiveSize();
+        report.checksum = Ecosystem::ComputeChecksum(merged, static_cast<size_t>(ecosystem.GetFoodCount()),
+                                                     ecosystem.GetFoodField());
+        return true;
+    });
+}
+
+// 🔑 RÉFÉRENCE EN UN SEUL PROCESSUS
+uint64_t TileRunner::RunReference(const SimulationConfig& config, uint32_t seed) {
+    Ecosystem ecosystem(config.worldWidth, config.worldHeight, config.maxEntities);
+    ecosystem.SetThreadCount(TileThreadCount(config));
+    ecosystem.SetHistoryCapacity(1);
+    ecosystem.SetSeed(seed);
+    ecosystem.Initialize(config.initialHerbivores, config.initialCarnivores, config.initialPlants);
+    for (long long tick = 0; tick < config.maxTicks; ++tick) ecosystem.Update(config.fixedDeltaTime);
+    return ecosystem.ComputeChecksum();
+}
+
+} // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,179 @@
+#include "Core/TileExchange.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <thread>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <signal.h>
+#include <sys/prctl.h>
+#endif
+
+namespace Ecosystem {
+namespace Core {
+
+// 🔒 EN-TÊTE DE LA ZONE PARTAGÉE (atomiques sans verrou : valables d'un processus à l'autre)
+struct TileExchange::Shared {
+    std::atomic<uint32_t> arrived;
+    std::atomic<uint32_t> generation;
+    std::atomic<uint32_t> failed;
+};
+
+namespace {
+const size_t SHARED_HEADER_BYTES = 64;  // Boîtes aux lettres alignées sur une ligne de cache
+}
+
+TileExchange::TileExchange(void* region, size_t mailboxBytes, int rank, int rankCount)
+    : mShared(static_cast<Shared*>(region)),
+      mMailboxes(static_cast<uint8_t*>(region) + SHARED_HEADER_BYTES), mMailboxBytes(mailboxBytes),
+      mRank(rank), mRankCount(rankCount), mChildFailed(false) {}
+
+// 🚀 LANCEMENT DES RANGS
+bool TileExchange::Launch(int rankCount, size_t mailboxBytes, const std::function<bool(TileExchange&)>& body) {
+#if defined(_WIN32)
+    (void)rankCount;
+    (void)mailboxBytes;
+    (void)body;
+    std::cerr << "❌ Découpage en tuiles indisponible sur cette plateforme (fork et mémoire partagée)" << std::endl;
+    return false;
+#else
+    mailboxBytes = (mailboxBytes + 63) / 64 * 64;
+    const size_t regionBytes = SHARED_HEADER_BYTES + static_cast<size_t>(rankCount) * mailboxBytes;
+    void* region = mmap(nullptr, regionBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (region == MAP_FAILED) {
+        std::cerr << "❌ Zone partagée de " << regionBytes << " octets impossible à créer" << std::endl;
+        return false;
+    }
+    Shared* shared = new (region) Shared();
+    shared->arrived.store(0);
+    shared->generation.store(0);
+    shared->failed.store(0);
+
+    // Les tampons de sortie ne doivent pas être recopiés dans les enfants
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+    std::vector<int> children;
+    for (int rank = 1; rank < rankCount; ++rank) {
+        const pid_t pid = fork();
+        if (pid < 0) {
+            std::cerr << "❌ fork impossible pour le rang " << rank << std::endl;
+            shared->failed.store(1);
+            break;
+        }
+        if (pid == 0) {
+#if defined(__linux__)
+            prctl(PR_SET_PDEATHSIG, SIGKILL);  // Rang 0 disparu : personne n'attendrait plus ce rang
+#endif
+            TileExchange exchange(region, mailboxBytes, rank, rankCount);
+            const bool ok = body(exchange);
+            if (!ok) exchange.Fail();
+            std::cout.flush();
+            std::cerr.flush();
+            // Sans destructeurs statiques : les threads du parent (journal) n'existent pas ici
+            _exit(ok ? 0 : 1);
+        }
+        children.push_back(static_cast<int>(pid));
+    }
+
+    TileExchange exchange(region, mailboxBytes, 0, rankCount);
+    exchange.mChildren = children;
+    bool ok = !exchange.HasFailed() && body(exchange);
+    if (!ok) exchange.Fail();
+    for (int child : exchange.mChildren) {
+        int status = 0;
+        if (waitpid(child, &status, 0) != child || !WIFEXITED(status) || WEXITSTATUS(status) != 0) ok = false;
+    }
+    ok = ok && !exchange.mChildFailed && !exchange.HasFailed();
+    munmap(region, regionBytes);
+    return ok;
+#endif
+}
+
+// 🔁 ÉCHANGE : dépôt, barrière, lecture, barrière
+bool TileExchange::Exchange(const Messages& outgoing, Messages& incoming) {
+    uint8_t* box = MailboxOf(mRank);
+    const size_t tableBytes = static_cast<size_t>(mRankCount + 1) * sizeof(uint64_t);
+    size_t total = tableBytes;
+    for (int rank = 0; rank < mRankCount; ++rank) total += outgoing[rank].size();
+    if (total > mMailboxBytes) {
+        std::cerr << "❌ Boîte aux lettres du rang " << mRank << " trop petite: " << total << " octets pour "
+                  << mMailboxBytes << " (voir --tile-buffer)" << std::endl;
+        Fail();
+    } else {
+        uint64_t offsets[2] = {tableBytes, tableBytes};
+        for (int rank = 0; rank < mRankCount; ++rank) {
+            const std::vector<uint8_t>& message = outgoing[rank];
+            if (!message.empty()) std::memcpy(box + offsets[0], message.data(), message.size());
+            offsets[1] = offsets[0] + message.size();
+            std::memcpy(box + rank * sizeof(uint64_t), &offsets[0], sizeof(uint64_t));
+            offsets[0] = offsets[1];
+        }
+        std::memcpy(box + mRankCount * sizeof(uint64_t), &offsets[0], sizeof(uint64_t));
+    }
+    if (!Barrier()) return false;
+    incoming.resize(mRankCount);
+    for (int rank = 0; rank < mRankCount; ++rank) {
+        const uint8_t* other = MailboxOf(rank);
+        uint64_t range[2];
+        std::memcpy(range, other + mRank * sizeof(uint64_t), sizeof(range));
+        incoming[rank].assign(other + range[0], other + range[1]);
+    }
+    return Barrier();
+}
+
+// 🚧 BARRIÈRE À GÉNÉRATIONS : le dernier arrivé libère les autres
+bool TileExchange::Barrier() {
+    const uint32_t generation = mShared->generation.load(std::memory_order_acquire);
+    if (mShared->arrived.fetch_add(1, std::memory_order_acq_rel) + 1 == static_cast<uint32_t>(mRankCount)) {
+        mShared->arrived.store(0, std::memory_order_relaxed);
+        mShared->generation.fetch_add(1, std::memory_order_acq_rel);
+        return !HasFailed();
+    }
+    for (uint32_t spin = 0; mShared->generation.load(std::memory_order_acquire) == generation; ++spin) {
+        if (HasFailed()) return false;
+        if (spin < 64) continue;
+        // Plus de rangs que de cœurs : l'attente laisse la main aux autres processus
+        if (mRank == 0 && (spin & 1023) == 0) PollChildren(generation);
+        std::this_thread::yield();
+    }
+    return !HasFailed();
+}
+
+void TileExchange::Fail() {
+    mShared->failed.store(1, std::memory_order_release);
+}
+
+bool TileExchange::HasFailed() const {
+    return mShared->failed.load(std::memory_order_acquire) != 0;
+}
+
+// 👀 Un enfant terminé alors que la barrière n'est pas levée n'y viendra jamais
+// (s'il l'a levée en dernier arrivant avant de sortir, la génération a changé)
+void TileExchange::PollChildren(uint32_t generation) {
+#if !defined(_WIN32)
+    for (size_t k = 0; k < mChildren.size(); ++k) {
+        int status = 0;
+        const int pid = mChildren[k];
+        if (waitpid(pid, &status, WNOHANG) != pid) continue;
+        mChildren.erase(mChildren.begin() + static_cast<std::ptrdiff_t>(k));
+        const bool clean = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        if (clean && mShared->generation.load(std::memory_order_acquire) != generation) return;
+        std::cerr << "❌ Le processus " << pid << " s'est arrêté avant la fin du découpage" << std::endl;
+        mChildFailed = true;
+        Fail();
+        return;
+    }
+#else
+    (void)generation;
+#endif
+}
+
+} // namespace Core
+} // namespace Ecosystem
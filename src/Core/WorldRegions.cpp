@@ -0,0 +1,217 @@
+#include "Core/WorldRegions.h"
+#include "Core/Entity.h"
+#include "Core/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Ecosystem {
+namespace Core {
+
+namespace {
+
+const int64_t NO_AGE_DEADLINE = INT64_MAX;
+const double NO_GROWTH_DEADLINE = std::numeric_limits<double>::infinity();
+
+// Échéances d'une plante qui peut dormir dès ce tick (false si inéligible) : ni affamée ni
+// fertile, réveil avant sa mort de vieillesse, avant le seuil de fertilité (Entity::CanReproduce)
+// ou, déjà au-dessus, avant sa maturité et son plafond d'énergie. L'énergie en forme close
+// est arrondie en float : la marge réveille un peu avant que le seuil soit réellement franchi
+bool SleepDeadlines(const EntityStore& store, size_t i, int64_t& ageDue, double& growthDue) {
+    if (!TraitsOf(store.type[i]).clocked) return false;
+    const float energy = store.ClockedEnergyOf(i);
+    const float maxEnergy = store.maxEnergy[i];
+    if (!(energy > 0.0f)) return false;  // Morte de faim ce tick
+    const double margin = 1e-4 * (std::fabs(maxEnergy) + 1.0);
+    double target = maxEnergy * 0.8f;
+    ageDue = store.ageMark[i] + (store.maxAge[i] - store.age[i]);  // Comme PlantSchedule
+    growthDue = NO_GROWTH_DEADLINE;
+    if (energy > target - margin) {
+        if (store.ClockedAgeOf(i) > REPRODUCTION_MIN_AGE) return false;  // Fertile, ou sur le point de l'être
+        ageDue = std::min(ageDue, store.ageMark[i] + (REPRODUCTION_MIN_AGE + 1 - store.age[i]));
+        if (energy >= maxEnergy) return true;  // Au plafond : plus rien ne change avant la maturité
+        target = maxEnergy;
+    }
+    // Énergie sans plafond : energy + (horloge - date)
+    growthDue = store.growthMark[i] + (target - store.energy[i]) - margin;
+    return store.plantClocks.growth < growthDue;
+}
+
+} // namespace
+
+// 🏗 CONSTRUCTEUR
+WorldRegions::WorldRegions()
+    : mRegionSize(REGION_SIZE), mInvRegionSize(1.0f / REGION_SIZE), mColumns(0), mRows(0), mEnabled(true) {}
+
+// ⚙️ CONFIGURATION
+void WorldRegions::Configure(float worldWidth, float worldHeight, float regionSize) {
+    mRegionSize = regionSize > 0.0f ? regionSize : REGION_SIZE;
+    mInvRegionSize = 1.0f / mRegionSize;
+    mColumns = std::max(1, static_cast<int>(std::ceil(worldWidth / mRegionSize)));
+    mRows = std::max(1, static_cast<int>(std::ceil(worldHeight / mRegionSize)));
+    mRegions.assign(static_cast<size_t>(mColumns) * mRows, Region{});
+    mActive.assign(mRegions.size(), 0);
+    mActiveList.clear();
+    Reset();
+}
+
+void WorldRegions::Reset() {
+    for (uint32_t r : mSleeping) {
+        Region& region = mRegions[r];
+        region.asleep = 0;
+        ++region.serial;
+        region.members.clear();
+        region.energy = SleepingEnergy{};
+    }
+    mSleeping.clear();
+    mAgeDue = DueQueue<int64_t>();
+    mGrowthDue = DueQueue<double>();
+    mEnergy = SleepingEnergy{};
+}
+
+void WorldRegions::SetEnabled(bool enabled, EntityStore& store, std::vector<size_t>& changed) {
+    if (!enabled) WakeAll(store, changed);
+    mEnabled = enabled;
+}
+
+// ⏰ RÉVEIL : animal dans le voisinage, ou échéance d'un membre atteinte
+void WorldRegions::Wake(EntityStore& store, const std::vector<uint32_t>& awakeRows, std::vector<size_t>& changed) {
+    if (!mEnabled || mRegions.empty()) return;
+    ECO_PROFILE_ZONE("WorldRegions::Wake");
+    MarkActivity(store, awakeRows);
+    for (uint32_t r : mActiveList) {
+        if (mRegions[r].asleep) WakeRegion(r, store, changed);
+    }
+    // Échéances périmées (région réveillée depuis) simplement écartées
+    while (!mAgeDue.empty() && mAgeDue.top().due <= store.plantClocks.age) {
+        const Due<int64_t> due = mAgeDue.top();
+        mAgeDue.pop();
+        if (mRegions[due.region].asleep && mRegions[due.region].serial == due.serial) WakeRegion(due.region, store, changed);
+    }
+    while (!mGrowthDue.empty() && mGrowthDue.top().due <= store.plantClocks.growth) {
+        const Due<double> due = mGrowthDue.top();
+        mGrowthDue.pop();
+        if (mRegions[due.region].asleep && mRegions[due.region].serial == due.serial) WakeRegion(due.region, store, changed);
+    }
+}
+
+void WorldRegions::WakeAll(EntityStore& store, std::vector<size_t>& changed) {
+    while (!mSleeping.empty()) WakeRegion(mSleeping.back(), store, changed);
+}
+
+void WorldRegions::WakeAt(Vector2D position, EntityStore& store, std::vector<size_t>& changed) {
+    if (mRegions.empty()) return;
+    const size_t r = RegionOf(position);
+    if (mRegions[r].asleep) WakeRegion(r, store, changed);
+}
+
+// 🐾 ACTIVITÉ : chaque animal vivant marque sa région et ses huit voisines
+void WorldRegions::MarkActivity(const EntityStore& store, const std::vector<uint32_t>& awakeRows) {
+    for (uint32_t r : mActiveList) mActive[r] = 0;
+    mActiveList.clear();
+    for (uint32_t i : awakeRows) {
+        if (!store.alive[i] || TraitsOf(store.type[i]).clocked) continue;
+        const size_t r = RegionOf(store.position[i]);
+        const int column = static_cast<int>(r % mColumns);
+        const int row = static_cast<int>(r / mColumns);
+        for (int y = std::max(row - 1, 0); y <= std::min(row + 1, mRows - 1); ++y) {
+            for (int x = std::max(column - 1, 0); x <= std::min(column + 1, mColumns - 1); ++x) {
+                const size_t neighbour = static_cast<size_t>(y) * mColumns + x;
+                if (mActive[neighbour]) continue;
+                mActive[neighbour] = 1;
+                mActiveList.push_back(static_cast<uint32_t>(neighbour));
+            }
+        }
+    }
+}
+
+void WorldRegions::WakeRegion(size_t regionIndex, EntityStore& store, std::vector<size_t>& changed) {
+    Region& region = mRegions[regionIndex];
+    for (const EntityHandle& handle : region.members) {
+        const size_t index = store.IndexOf(handle);
+        if (index == SIZE_MAX) continue;
+        store.asleep[index] = 0;
+        changed.push_back(index);
+    }
+    region.members.clear();
+    region.asleep = 0;
+    ++region.serial;
+    mEnergy.capped -= region.energy.capped;
+    mEnergy.open -= region.energy.open;
+    mEnergy.openCount -= region.energy.openCount;
+    mEnergy.count -= region.energy.count;
+    region.energy = SleepingEnergy{};
+    // Retrait de mSleeping par échange avec la dernière
+    const uint32_t last = mSleeping.back();
+    mSleeping[region.sleepingSlot] = last;
+    mRegions[last].sleepingSlot = region.sleepingSlot;
+    mSleeping.pop_back();
+    if (mSleeping.empty()) mEnergy = SleepingEnergy{};  // Sans les résidus des soustractions
+}
+
+// 💤 MISE EN SOMMEIL : plantes éligibles des régions calmes, une à une
+void WorldRegions::TrySleep(EntityStore& store, const std::vector<uint32_t>& candidates,
+                            std::vector<size_t>& changed) {
+    if (!mEnabled || mRegions.empty()) return;
+    ECO_PROFILE_ZONE("WorldRegions::TrySleep");
+    mTouched.clear();
+    for (uint32_t i : candidates) {
+        if (!store.alive[i] || store.asleep[i]) continue;
+        const size_t r = RegionOf(store.position[i]);
+        if (mActive[r]) continue;
+        int64_t ageDue = 0;
+        double growthDue = 0.0;
+        if (!SleepDeadlines(store, i, ageDue, growthDue)) continue;
+        Region& region = mRegions[r];
+        if (!region.asleep) {
+            region.asleep = 1;
+            region.ageDeadline = NO_AGE_DEADLINE;
+            region.growthDeadline = NO_GROWTH_DEADLINE;
+            region.sleepingSlot = static_cast<uint32_t>(mSleeping.size());
+            mSleeping.push_back(static_cast<uint32_t>(r));
+        }
+        if (!region.touched) {
+            region.touched = 1;
+            mTouched.push_back(static_cast<uint32_t>(r));
+        }
+        region.ageDeadline = std::min(region.ageDeadline, ageDue);
+        region.growthDeadline = std::min(region.growthDeadline, growthDue);
+        // Énergie agrégée : fixe au plafond, sinon affine en l'horloge de croissance
+        SleepingEnergy added;
+        const float energy = store.ClockedEnergyOf(i);
+        if (energy >= store.maxEnergy[i]) {
+            added.capped = energy;
+        } else {
+            added.open = static_cast<double>(store.energy[i]) - store.growthMark[i];
+            added.openCount = 1;
+        }
+        added.count = 1;
+        for (SleepingEnergy* total : {&region.energy, &mEnergy}) {
+            total->capped += added.capped;
+            total->open += added.open;
+            total->openCount += added.openCount;
+            total->count += added.count;
+        }
+        store.asleep[i] = 1;
+        region.members.push_back(store.GetHandle(i));
+        changed.push_back(i);
+    }
+    // Une échéance par région qui a pris des membres
+    for (uint32_t r : mTouched) {
+        Region& region = mRegions[r];
+        region.touched = 0;
+        if (region.ageDeadline != NO_AGE_DEADLINE) mAgeDue.push({region.ageDeadline, r, region.serial});
+        if (region.growthDeadline != NO_GROWTH_DEADLINE) mGrowthDue.push({region.growthDeadline, r, region.serial});
+    }
+}
+
+// 🔍 RÉGION D'UNE POSITION (hors du monde : régions du bord)
+size_t WorldRegions::RegionOf(Vector2D position) const {
+    // Bornée en flottant avant le cast (positions hors monde ou NaN)
+    const int column = static_cast<int>(std::fmin(std::fmax(position.x * mInvRegionSize, 0.0f), static_cast<float>(mColumns - 1)));
+    const int row = static_cast<int>(std::fmin(std::fmax(position.y * mInvRegionSize, 0.0f), static_cast<float>(mRows - 1)));
+    return static_cast<size_t>(row) * mColumns + static_cast<size_t>(column);
+}
+
+} // namespace Core
+} // namespace Ecosystem
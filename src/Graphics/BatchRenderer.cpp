@@ -0,0 +1,54 @@
+#include "Graphics/BatchRenderer.h"
+#include "Core/Profiler.h"
+#include <algorithm>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🏗 CONSTRUCTEUR
+BatchRenderer::BatchRenderer() : mDrawCalls(0) {}
+
+// 🧹 NOUVELLE IMAGE
+void BatchRenderer::Begin() {
+    mVertices.clear();
+}
+
+void BatchRenderer::Reserve(size_t rectCount) {
+    mVertices.reserve(rectCount * 4);
+}
+
+// ➕ RECTANGLE PLEIN : 4 sommets, 2 triangles
+void BatchRenderer::AddRect(float x, float y, float width, float height, const Core::Color& color) {
+    const SDL_FColor fill = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+
+    mVertices.push_back({{x, y}, fill, {0.0f, 0.0f}});
+    mVertices.push_back({{x + width, y}, fill, {0.0f, 0.0f}});
+    mVertices.push_back({{x + width, y + height}, fill, {0.0f, 0.0f}});
+    mVertices.push_back({{x, y + height}, fill, {0.0f, 0.0f}});
+}
+
+// 🚀 ENVOI
+void BatchRenderer::Flush(SDL_Renderer* renderer) {
+    ECO_PROFILE_ZONE("BatchRenderer::Flush");
+    mDrawCalls = 0;
+    const size_t rectCount = GetRectCount();
+
+    // Les indices ne dépendent que du rang du rectangle dans sa tranche :
+    // construits une fois, partagés par toutes les tranches et toutes les images
+    const size_t needed = std::min(rectCount, MAX_RECTS_PER_CALL);
+    for (size_t rect = mIndices.size() / 6; rect < needed; ++rect) {
+        const int base = static_cast<int>(rect * 4);
+        const int quad[6] = {base, base + 1, base + 2, base, base + 2, base + 3};
+        mIndices.insert(mIndices.end(), quad, quad + 6);
+    }
+    for (size_t first = 0; first < rectCount; first += MAX_RECTS_PER_CALL) {
+        const size_t count = std::min(MAX_RECTS_PER_CALL, rectCount - first);
+        SDL_RenderGeometry(renderer, nullptr,
+                           mVertices.data() + first * 4, static_cast<int>(count * 4),
+                           mIndices.data() + first * 6, static_cast<int>(count * 6));
+        mDrawCalls++;
+    }
+}
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -0,0 +1,59 @@
+#include "Graphics/DensityTexture.h"
+#include "Core/Profiler.h"
+#include <algorithm>
+
+namespace Ecosystem {
+namespace Graphics {
+
+// 🏗 CONSTRUCTEUR
+DensityTexture::DensityTexture() : mTexture(nullptr), mColumns(0), mRows(0), mSerial(UINT64_MAX) {}
+
+DensityTexture::~DensityTexture() {
+    Release();
+}
+
+void DensityTexture::Release() {
+    if (mTexture) SDL_DestroyTexture(mTexture);
+    mTexture = nullptr;
+    mColumns = 0;
+    mRows = 0;
+}
+
+// 📤 ENVOI DES TUILES MODIFIÉES
+void DensityTexture::Apply(SDL_Renderer* renderer, const Core::RenderFrame& frame) {
+    if (frame.serial == mSerial) return;  // Image déjà appliquée
+    mSerial = frame.serial;
+    const Core::DensityPatch& patch = frame.density;
+    if (patch.columns <= 0 || patch.rows <= 0) return;
+    ECO_PROFILE_ZONE("DensityTexture::Apply");
+    if (!mTexture || patch.columns != mColumns || patch.rows != mRows) {
+        // Nouvelle géométrie : la carte reconfigurée arrive entière dans cette image
+        Release();
+        mTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING,
+                                     patch.columns, patch.rows);
+        if (!mTexture) return;
+        SDL_SetTextureBlendMode(mTexture, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureScaleMode(mTexture, SDL_SCALEMODE_LINEAR);
+        mColumns = patch.columns;
+        mRows = patch.rows;
+    }
+    for (const Core::DensityPatch::Region& region : patch.regions) {
+        const SDL_Rect rect = {region.x, region.y, region.width, region.height};
+        SDL_UpdateTexture(mTexture, &rect, patch.pixels.data() + region.offset,
+                          region.width * static_cast<int>(sizeof(uint32_t)));
+    }
+}
+
+// 🎨 CARTE ÉTIRÉE SUR LE MONDE
+void DensityTexture::Draw(SDL_Renderer* renderer, const Core::RenderFrame& frame, const Core::RenderView& view) const {
+    const float opacity = 1.0f - std::clamp(frame.detail, 0.0f, 1.0f);
+    if (!mTexture || opacity <= 0.0f) return;
+    const float cellSize = frame.density.cellSize;
+    const SDL_FRect destination = {-view.x * view.scale, -view.y * view.scale,
+                                   mColumns * cellSize * view.scale, mRows * cellSize * view.scale};
+    SDL_SetTextureAlphaMod(mTexture, static_cast<uint8_t>(opacity * 255.0f));
+    SDL_RenderTexture(renderer, mTexture, nullptr, &destination);
+}
+
+} // namespace Graphics
+} // namespace Ecosystem
@@ -39,6 +39,9 @@ bool Window::Initialize() {
         return false;
     }
 
+    // Transparence respectée : champ de nourriture, fondu entre carte de densité et entités
+    SDL_SetRenderDrawBlendMode(mRenderer, SDL_BLENDMODE_BLEND);
+
     mIsInitialized = true;
     std::cout << "✅ Fenêtre initialisée: " << mTitle << " (" << mWidth << "x" << mHeight << ")" << std::endl;
     return true;
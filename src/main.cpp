@@ -1,17 +1,109 @@
+#include "Core/EnsembleRunner.h"
 #include "Core/GameEngine.h"
+#include "Core/HeadlessEngine.h"
+#include "Core/SimulationConfig.h"
+#include "Core/TileDomain.h"
+#include "Core/Logger.h"
+#include "Core/Profiler.h"
 #include <chrono> 
 #include <iostream> 
-#include <cstdlib> 
-#include <ctime> 
 int main(int argc, char* argv[]) { 
-    // Initialisation de l'aléatoire 
-    std::srand(static_cast<unsigned int>(std::time(nullptr))); 
+    // 🧾 Options de la ligne de commande 
+    Ecosystem::Core::SimulationConfig config; 
+    if (!Ecosystem::Core::ParseCommandLine(argc, argv, config)) { 
+        Ecosystem::Core::PrintUsage(argv[0]); 
+        return -1; 
+    }
+    if (config.showHelp) { 
+        Ecosystem::Core::PrintUsage(argv[0]); 
+        return 0; 
+    }
+     
+    // 📝 Journal asynchrone : niveau et éventuel fichier d'événements binaires 
+    Ecosystem::Core::Logger::SetLevel(config.logLevel); 
+    if (!config.eventLogPath.empty() && !Ecosystem::Core::Logger::Instance().OpenEventFile(config.eventLogPath)) { 
+        return -1; 
+    }
+     
+    // ⚡ Jeu d'instructions des noyaux de steering 
+    if (!Ecosystem::Core::SetSimdPath(config.simdPath)) { 
+        return -1; 
+    }
+     
+    // 🧪 Ensemble : des runs indépendants en parallèle, sans fenêtre 
+    if (!config.ensemblePath.empty()) { 
+        Ecosystem::Core::EnsembleSpec spec; 
+        if (!spec.Load(config.ensemblePath)) { 
+            return -1; 
+        }
+        Ecosystem::Core::EnsembleRunner::Report report{0, 0.0, 0}; 
+        if (!Ecosystem::Core::EnsembleRunner::Run(spec, config.ensembleOutputPath, config.threadCount, report)) { 
+            return -1; 
+        }
+        Ecosystem::Core::Logger::Instance().Flush(); 
+        std::cout << "🧪 " << report.runs << " runs en " << report.seconds << " s sur " << report.workers 
+                  << " worker(s), SIMD " << Ecosystem::Core::SimdPathName(Ecosystem::Core::GetSimdPath()) 
+                  << " → " << config.ensembleOutputPath << std::endl; 
+        return 0; 
+    }
+     
+    // 🧩 Tuiles : un processus par tuile, état final réuni dans celui-ci 
+    if (config.tileColumns > 0) { 
+        Ecosystem::Core::TileRunner::Report report{}; 
+        if (!Ecosystem::Core::TileRunner::Run(config, report)) { 
+            return -1; 
+        }
+        Ecosystem::Core::Logger::Instance().Flush(); 
+        std::cout << "🧩 " << config.tileColumns << "x" << config.tileRows << " tuiles (" << report.ranks 
+                  << " processus), graine " << report.seed << ": " << report.ticks << " ticks en " 
+                  << report.elapsedSeconds << " s, tuile la plus peuplée " << report.largestTile << " entités" << std::endl; 
+        std::cout << "📊 Final - Herbivores: " << report.herbivores 
+                  << ", Carnivores: " << report.carnivores 
+                  << ", Plantes: " << report.plants 
+                  << ", Nourriture: " << report.food 
+                  << ", Entités: " << report.entities << std::endl; 
+        std::cout << "🔑 Empreinte de l'état: " << std::hex << report.checksum << std::dec << std::endl; 
+        if (config.tileCheck) { 
+            const uint64_t reference = Ecosystem::Core::TileRunner::RunReference(config, report.seed); 
+            if (reference != report.checksum) { 
+                std::cerr << "❌ Empreinte différente d'une exécution en un seul processus: " << std::hex 
+                          << reference << std::dec << std::endl; 
+                return -1; 
+            }
+            std::cout << "✅ Identique à l'exécution en un seul processus" << std::endl; 
+        }
+        return 0; 
+    }
+     
+    // 🖥 Mode sans fenêtre : simulation pure, aucun appel à SDL 
+    if (config.headless) { 
+        Ecosystem::Core::HeadlessEngine headless(config); 
+        if (!headless.Initialize()) { 
+            return -1; 
+        }
+        // Une reconstruction ne continue que si --ticks ou --time-budget le demande 
+        Ecosystem::Core::HeadlessEngine::RunReport report{0, 0.0, 0.0, 0.0}; 
+        if (config.replayPath.empty() || config.maxTicks > 0 || config.timeBudgetSeconds > 0.0) { 
+            report = headless.Run(); 
+        }
+        headless.PrintReport(report); 
+        if (!config.statsHistoryPath.empty() && !headless.GetEcosystem().GetHistory().WriteCsv(config.statsHistoryPath)) { 
+            return -1; 
+        }
+        if (!config.profilePath.empty() && !Ecosystem::Core::Profiler::Instance().EndCapture(config.profilePath)) { 
+            return -1; 
+        }
+        if (!config.saveSnapshotPath.empty() && !headless.GetEcosystem().SaveSnapshot(config.saveSnapshotPath)) { 
+            return -1; 
+        }
+        return 0; 
+    }
      
     std::cout << "🎮Démarrage du Simulateur d'Écosystème" << std::endl; 
     std::cout << "=======================================" << std::endl; 
      
     // 🏗 Création du moteur de jeu 
-    Ecosystem::Core::GameEngine engine("Simulateur d'Écosystème Intelligent", 1200.0f, 600.0f);
+    Ecosystem::Core::GameEngine engine("Simulateur d'Écosystème Intelligent", config);
      
     // ⚙Initialisation 
     if (!engine.Initialize()) { 
@@ -19,24 +111,24 @@ int main(int argc, char* argv[]) {
         return -1; 
     }
      
+    Ecosystem::Core::Logger::Instance().Flush(); 
     std::cout << "✅Moteur initialisé avec succès" << std::endl; 
     std::cout << "🎯Lancement de la simulation..." << std::endl; 
     std::cout << "=== CONTRÔLES ===" << std::endl; 
     std::cout << "ESPACE: Pause/Reprise" << std::endl; 
     std::cout << "R: Reset simulation" << std::endl; 
     std::cout << "F: Ajouter nourriture" << std::endl; 
+    std::cout << "S: Sauvegarder un instantané" << std::endl; 
+    std::cout << "P: Répartition du temps d'image" << std::endl; 
     std::cout << "FLÈCHES: Vitesse simulation" << std::endl; 
     std::cout << "ÉCHAP: Quitter" << std::endl;
-    
-    Ecosystem::Core::GameEngine::HandleInput;
-    Ecosystem::Core::Ecosystem::SpawnFood;
-    Ecosystem::Core::Ecosystem::RemoveDeadEntities;
      
     // Boucle principale 
     engine.Run(); 
      
     // Arrêt propre 
     engine.Shutdown(); 
+    Ecosystem::Core::Logger::Instance().Flush(); 
      
     std::cout << "👋Simulation terminée. Au revoir !" << std::endl; 
     return 0; 